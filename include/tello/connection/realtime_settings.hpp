@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "../macro_definition.hpp"
+
+#define REALTIME_ANY_CPU (-1)
+#define REALTIME_CACHED_FRAMES 16
+#define REALTIME_RECORDED_FRAMES 16
+
+using std::vector;
+
+namespace tello {
+
+    /**
+     * Scheduling of the listener and dispatch threads for closed-loop flight
+     */
+    struct EXPORT RealtimeSettings {
+        int _statusCpu = REALTIME_ANY_CPU;
+        int _commandCpu = REALTIME_ANY_CPU;
+        int _videoCpu = REALTIME_ANY_CPU;
+        /**
+         * Dispatch worker i runs on '_dispatchCpus[i % size]', empty keeps the workers unpinned
+         */
+        vector<int> _dispatchCpus;
+        /**
+         * Real-time priority (SCHED_FIFO 1 - 99), 0 keeps the normal scheduler
+         */
+        int _priority = 0;
+        /**
+         * Locks all memory of the process after the frame buffers are preallocated
+         */
+        bool _lockMemory = false;
+        /**
+         * Frame buffers allocated up front. If not 0, reassembly drops frames instead of allocating buffers.
+         * Every drone holds up to '_maxCachedFrames' + VIDEO_QUEUE_CAPACITY + 2 reassembly buffers,
+         * plus '_maxRecordedFrames' + 1 (parameter sets) with a video recorder and the frames kept by handlers.
+         */
+        size_t _preallocatedFrames = 0;
+        /**
+         * With preallocated frames, the GOP cache of a drone holds at most that many frames,
+         * so a cached group never takes the buffer the next keyframe needs
+         */
+        size_t _maxCachedFrames = REALTIME_CACHED_FRAMES;
+        /**
+         * With preallocated frames, a video recorder holds at most that many frames, queued and being written
+         */
+        size_t _maxRecordedFrames = REALTIME_RECORDED_FRAMES;
+        /**
+         * Records the time from queuing a dispatch task until a worker starts it
+         */
+        bool _measureWakeup = false;
+    };
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../macro_definition.hpp"
+#include "../latency_histogram.hpp"
+#include "realtime_settings.hpp"
+#include "../executor.hpp"
+#include <memory>
 
 namespace tello {
     class EXPORT TelloNetwork {
@@ -11,5 +15,29 @@ namespace tello {
 
         static bool connect();
         static void disconnect();
+
+        /**
+         * Workers calling the video handlers. The frames of one drone are always delivered in order
+         * by one worker at a time, different drones are served in parallel.
+         */
+        static void setDispatchThreads(int threads);
+
+        /**
+         * Executor of the status and video handlers of every drone without an executor of its own.
+         * nullptr restores the dispatch workers of the library.
+         */
+        static void setExecutor(std::shared_ptr<Executor> executor);
+
+        /**
+         * Pins the threads, raises their priority and preallocates the frame buffers.
+         * Real-time priorities and memory locking usually need privileges (CAP_SYS_NICE, CAP_IPC_LOCK).
+         * @return false, if a setting could not be applied, the others are applied anyway
+         */
+        static bool setRealtime(const RealtimeSettings& settings);
+
+        /**
+         * Latency from queuing a handler until a dispatch worker runs it, see RealtimeSettings::_measureWakeup
+         */
+        static const LatencyHistogram& wakeupLatency();
     };
 }
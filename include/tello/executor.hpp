@@ -0,0 +1,31 @@
+#pragma once
+
+#include "task.hpp"
+#include "macro_definition.hpp"
+
+namespace tello {
+
+    /**
+     * Move-only, stores the dispatch of a drone inline, call it with 'task(0)'
+     */
+    using executor_task = threading::Task;
+
+    /**
+     * Runs the dispatch of handlers, e.g. on the event loop of the application (asio io_context, ROS executor).
+     * 'post' is called by the listener threads and must not block. The tasks of one drone are posted
+     * one after another, so an executor may run them concurrently with the tasks of other drones.
+     */
+    class EXPORT Executor {
+    public:
+        virtual ~Executor() = default;
+        virtual void post(executor_task&& task) = 0;
+    };
+
+    /**
+     * Runs the handlers directly on the listener thread: lowest latency, but a slow handler delays the reception.
+     */
+    class EXPORT InlineExecutor : public Executor {
+    public:
+        void post(executor_task&& task) override;
+    };
+}
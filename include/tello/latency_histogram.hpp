@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "macro_definition.hpp"
+
+#define LATENCY_BUCKETS 32
+
+namespace tello {
+
+    /**
+     * Lock-free histogram of latencies in microseconds. Bucket i counts latencies below 2^i us,
+     * recording is wait-free, so it can be used on the receive path.
+     */
+    class EXPORT LatencyHistogram {
+    public:
+        LatencyHistogram();
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        void record(int64_t latency);
+        void reset();
+
+        [[nodiscard]] uint64_t count() const;
+        [[nodiscard]] uint64_t bucket(int index) const;
+        [[nodiscard]] int64_t max() const;
+        [[nodiscard]] double mean() const;
+
+        /**
+         * Upper bound of the bucket holding the given percentile (0 - 100)
+         */
+        [[nodiscard]] int64_t percentile(double percentile) const;
+
+    private:
+        std::atomic<uint64_t> _buckets[LATENCY_BUCKETS];
+        std::atomic<uint64_t> _count;
+        std::atomic<uint64_t> _sum;
+        std::atomic<int64_t> _max;
+    };
+}
@@ -2,9 +2,11 @@
 
 #include <string>
 #include <optional>
+#include <cstddef>
 #include "../macro_definition.hpp"
 
 #define SEND_ERROR_CODE -1
+#define SEND_MAX_BUFFERS 8
 
 using ip_address = unsigned long;
 using std::string;
@@ -49,6 +51,14 @@ namespace tello {
         int _length;
     };
 
+    /**
+     * Part of a datagram, which is sent without copying
+     */
+    struct SendBuffer {
+        const char* _data;
+        size_t _length;
+    };
+
     class NetworkInterface {
     public:
         virtual ~NetworkInterface() = default;
@@ -60,5 +70,18 @@ namespace tello {
         [[nodiscard]] virtual int
         send(const int& fileDescriptor, const NetworkData& receiver, const string& value) const = 0;
         [[nodiscard]] virtual NetworkResponse read(const int& fileDescriptor) const = 0;
+
+        /**
+         * Sends one datagram gathered from up to SEND_MAX_BUFFERS buffers.
+         */
+        [[nodiscard]] virtual int
+        send(const int& fileDescriptor, const NetworkData& receiver, const SendBuffer* buffers, int count) const = 0;
+
+        /**
+         * Receives one datagram into a caller owned buffer without allocating.
+         * @return received bytes, 0 on timeout or error
+         */
+        [[nodiscard]] virtual int
+        read(const int& fileDescriptor, char* buffer, int length, NetworkData& sender) const = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "../response.hpp"
+#include "../macro_definition.hpp"
+#include "../video/h264.hpp"
+
+namespace tello {
+
+    /**
+     * One complete NAL unit including its start code, delivered on the video listener thread
+     * as soon as its last byte arrived. The data is only valid during the handler call
+     * and the handler has to return quickly, it delays the reception of the next packet.
+     */
+    class EXPORT NalUnitResponse : public Response {
+    public:
+        NalUnitResponse(const unsigned char* data, size_t length, bool lastInFrame, int64_t receiveTime);
+
+        [[nodiscard]] const unsigned char* data() const;
+        [[nodiscard]] size_t length() const;
+        [[nodiscard]] NalUnitType type() const;
+
+        /**
+         * The NAL unit completes an access unit (frame)
+         */
+        [[nodiscard]] bool lastInFrame() const;
+
+        /**
+         * Receive time of the packet completing the NAL unit in microseconds (steady clock)
+         */
+        [[nodiscard]] int64_t receiveTime() const;
+
+    private:
+        const unsigned char* _data;
+        size_t _length;
+        bool _lastInFrame;
+        int64_t _receiveTime;
+    };
+}
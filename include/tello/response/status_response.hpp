@@ -2,6 +2,7 @@
 
 #include "../response.hpp"
 #include "../macro_definition.hpp"
+#include "../telemetry/status_sample.hpp"
 
 namespace tello {
 
@@ -9,6 +10,12 @@ namespace tello {
 
     public:
         explicit StatusResponse(const string& response);
+        explicit StatusResponse(const StatusSample& sample);
+
+        /**
+         * Decoded state as delivered by the status listener
+         */
+        [[nodiscard]] const StatusSample& sample() const;
 
         string get_mpry() const;
 
@@ -71,9 +78,6 @@ namespace tello {
         int get_time() const;
 
     private:
-        unordered_map<string, string> values;
-        float readFloat(string&& key, float defaultValue) const;
-        int readInt(string&& key, int defaultValue) const;
-
+        StatusSample _sample;
     };
 }
\ No newline at end of file
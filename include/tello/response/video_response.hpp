@@ -3,25 +3,31 @@
 #include "../response.hpp"
 #include <string>
 #include "../macro_definition.hpp"
+#include "../video/frame_handle.hpp"
 
 using std::string;
 
 namespace tello {
 
+    /**
+     * Reassembled video frame. Copies share the same immutable buffer,
+     * so a frame can be kept by any number of consumers without copying it.
+     */
     class EXPORT VideoResponse : public Response {
     public:
-        VideoResponse(unsigned char* videoFrame, unsigned int length);
-        VideoResponse(const VideoResponse& other);
-        VideoResponse& operator=(const VideoResponse& other);
-        VideoResponse(VideoResponse&& other) noexcept;
-        VideoResponse& operator=(VideoResponse&& other) noexcept;
-        ~VideoResponse();
+        VideoResponse(const unsigned char* videoFrame, unsigned int length);
+        explicit VideoResponse(FrameHandle frame);
 
-        [[nodiscard]] unsigned char* videoFrame() const;
+        [[nodiscard]] const unsigned char* videoFrame() const;
         [[nodiscard]] unsigned int length() const;
+        [[nodiscard]] const FrameHandle& frame() const;
+
+        /**
+         * Keyframe flag and stream format (resolution, frame rate) of the frame
+         */
+        [[nodiscard]] const FrameInfo& info() const;
 
     private:
-        unsigned char* _videoFrame;
-        unsigned int _length;
+        FrameHandle _frame;
     };
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "macro_definition.hpp"
+
+using std::shared_ptr;
+using std::weak_ptr;
+
+namespace tello {
+
+    /**
+     * Owner of subscriptions, e.g. the status or video subscribers of a Tello
+     */
+    class SubscriptionSource {
+    public:
+        virtual ~SubscriptionSource() = default;
+        virtual void unsubscribe(uint64_t id) = 0;
+    };
+
+    /**
+     * RAII token of a subscription. The subscriber is removed when the token is destroyed
+     * or 'unsubscribe' is called. The token may outlive the Tello it was created from.
+     */
+    class EXPORT Subscription {
+    public:
+        Subscription();
+        Subscription(weak_ptr<SubscriptionSource> source, uint64_t id);
+        Subscription(const Subscription&) = delete;
+        Subscription& operator=(const Subscription&) = delete;
+        Subscription(Subscription&& other) noexcept;
+        Subscription& operator=(Subscription&& other) noexcept;
+        ~Subscription();
+
+        void unsubscribe();
+        [[nodiscard]] bool active() const;
+
+    private:
+        weak_ptr<SubscriptionSource> _source;
+        uint64_t _id;
+    };
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#define TASK_INLINE_SIZE 48
+
+namespace tello::threading {
+
+    /**
+     * Move-only callable 'void(int worker)'. Callables up to TASK_INLINE_SIZE bytes, e.g. lambdas capturing
+     * a few pointers or shared pointers, are stored inline, so pushing or posting a task does not allocate.
+     * Callers outside the thread pool pass worker 0.
+     */
+    class Task {
+    public:
+        Task() noexcept: _storage(), _operations(nullptr) {
+        }
+
+        template<typename Function, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, Task>>>
+        Task(Function&& function) : _storage(), _operations(nullptr) {
+            using Callable = std::decay_t<Function>;
+            if constexpr (isInline<Callable>()) {
+                new(_storage) Callable(std::forward<Function>(function));
+                _operations = &INLINE_OPERATIONS<Callable>;
+            } else {
+                new(_storage) Callable*(new Callable(std::forward<Function>(function)));
+                _operations = &HEAP_OPERATIONS<Callable>;
+            }
+        }
+
+        Task(Task&& other) noexcept: _storage(), _operations(other._operations) {
+            if (_operations != nullptr) {
+                _operations->_relocate(other._storage, _storage);
+                other._operations = nullptr;
+            }
+        }
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                reset();
+                _operations = other._operations;
+                if (_operations != nullptr) {
+                    _operations->_relocate(other._storage, _storage);
+                    other._operations = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            reset();
+        }
+
+        void operator()(int worker) {
+            _operations->_invoke(_storage, worker);
+        }
+
+        explicit operator bool() const {
+            return _operations != nullptr;
+        }
+
+        /**
+         * @return true, if the callable does not fit into the task and is allocated
+         */
+        [[nodiscard]] bool allocated() const {
+            return _operations != nullptr && _operations->_allocated;
+        }
+
+    private:
+        struct Operations {
+            void (* _invoke)(void* storage, int worker);
+            /**
+             * Moves the callable into 'to' and destroys it in 'from'
+             */
+            void (* _relocate)(void* from, void* to);
+            void (* _destroy)(void* storage);
+            bool _allocated;
+        };
+
+        template<typename Callable>
+        static constexpr bool isInline() {
+            return sizeof(Callable) <= TASK_INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible_v<Callable>;
+        }
+
+        template<typename Callable>
+        static constexpr Operations INLINE_OPERATIONS = {
+                [](void* storage, int worker) {
+                    (*static_cast<Callable*>(storage))(worker);
+                },
+                [](void* from, void* to) {
+                    new(to) Callable(std::move(*static_cast<Callable*>(from)));
+                    static_cast<Callable*>(from)->~Callable();
+                },
+                [](void* storage) {
+                    static_cast<Callable*>(storage)->~Callable();
+                },
+                false
+        };
+
+        template<typename Callable>
+        static constexpr Operations HEAP_OPERATIONS = {
+                [](void* storage, int worker) {
+                    (**static_cast<Callable**>(storage))(worker);
+                },
+                [](void* from, void* to) {
+                    new(to) Callable*(*static_cast<Callable**>(from));
+                },
+                [](void* storage) {
+                    delete *static_cast<Callable**>(storage);
+                },
+                true
+        };
+
+        alignas(std::max_align_t) unsigned char _storage[TASK_INLINE_SIZE];
+        const Operations* _operations;
+
+        void reset() {
+            if (_operations != nullptr) {
+                _operations->_destroy(_storage);
+                _operations = nullptr;
+            }
+        }
+    };
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+namespace tello {
+
+    /**
+     * Decides per subscription, which status samples are delivered.
+     * The filter is evaluated on the decoded sample inside the status listener,
+     * rejected samples never reach a handler.
+     *
+     * - deadband: deliver if the field moved at least 'threshold' since the last delivered sample
+     * - on change only: deliver if any field without deadband changed since the last delivered sample
+     * - max rate: deliver at most 'hertz' samples per second
+     *
+     * Without deadband and on change only every sample passes the change check.
+     */
+    class EXPORT StatusFilter {
+    public:
+        StatusFilter();
+
+        StatusFilter& deadband(StatusField field, double threshold);
+        StatusFilter& maxRate(double hertz);
+        StatusFilter& onChangeOnly(bool onChangeOnly = true);
+
+        [[nodiscard]] bool passesAll() const;
+
+        /**
+         * Checks the sample and remembers it as last delivered sample, if it passes.
+         * @param timestamp receive time in microseconds
+         */
+        bool accept(const StatusSample& sample, int64_t timestamp);
+        void reset();
+
+    private:
+        double _deadbands[STATUS_FIELD_COUNT];
+        bool _hasDeadband;
+        int64_t _minInterval;
+        bool _onChangeOnly;
+
+        StatusSample _lastSample;
+        int64_t _lastTimestamp;
+        bool _delivered;
+
+        [[nodiscard]] bool changed(const StatusSample& sample) const;
+    };
+}
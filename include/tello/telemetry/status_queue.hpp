@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+#define STATUS_QUEUE_CAPACITY 16
+
+using std::optional;
+using std::vector;
+
+namespace tello {
+
+    /**
+     * Status updates given up, when the handlers of a drone cannot keep up
+     */
+    enum class StatusDropPolicy {
+        /**
+         * The oldest queued update is dropped, handlers catch up with the latest state
+         */
+        DROP_OLDEST,
+        /**
+         * The new update is dropped, handlers get a gapless sequence up to the overflow
+         */
+        DROP_NEWEST
+    };
+
+    struct EXPORT StatusQueueStatistics {
+        size_t _depth = 0;
+        size_t _maxDepth = 0;
+        uint64_t _enqueued = 0;
+        uint64_t _delivered = 0;
+        uint64_t _dropped = 0;
+    };
+
+    struct EXPORT QueuedStatus {
+        StatusSample _sample;
+        /**
+         * Receive time in microseconds since epoch
+         */
+        int64_t _timestamp;
+        /**
+         * Bit per subscriber slot, set if the filter of the subscriber accepted the sample
+         */
+        uint64_t _accepted;
+    };
+
+    /**
+     * Bounded queue of the status updates of one drone, which wait for their handlers.
+     * The updates are kept in a preallocated ring, the status listener only copies a sample into it.
+     * A single task drains the queue, so the updates of a drone are delivered in order.
+     */
+    class EXPORT StatusQueue {
+    public:
+        explicit StatusQueue(size_t capacity = STATUS_QUEUE_CAPACITY,
+                             StatusDropPolicy policy = StatusDropPolicy::DROP_OLDEST);
+        StatusQueue(const StatusQueue&) = delete;
+        StatusQueue& operator=(const StatusQueue&) = delete;
+
+        void configure(size_t capacity, StatusDropPolicy policy);
+
+        /**
+         * @param accepted bit per subscriber slot, that accepted the sample
+         * @return true, if the queue was idle and a task has to drain it
+         */
+        bool push(const StatusSample& sample, int64_t timestamp, uint64_t accepted);
+
+        /**
+         * Next update for the handlers. Empty ends the drain, the next push starts a new one.
+         */
+        [[nodiscard]] optional<QueuedStatus> pop();
+
+        [[nodiscard]] StatusQueueStatistics statistics() const;
+
+    private:
+        mutable std::mutex _mutex;
+        vector<QueuedStatus> _ring;
+        size_t _head;
+        size_t _size;
+        StatusDropPolicy _policy;
+        bool _draining;
+        StatusQueueStatistics _statistics;
+    };
+}
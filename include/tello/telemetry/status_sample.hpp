@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include "../macro_definition.hpp"
+
+#define STATUS_FIELD_COUNT 20
+
+using std::optional;
+using std::string;
+
+namespace tello {
+
+    /**
+     * Fields of the Tello state string in the order they are stored
+     * inside the columnar telemetry formats.
+     */
+    enum class StatusField {
+        MID,
+        X,
+        Y,
+        Z,
+        PITCH,
+        ROLL,
+        YAW,
+        VGX,
+        VGY,
+        VGZ,
+        TEMPL,
+        TEMPH,
+        TOF,
+        H,
+        BAT,
+        BARO,
+        TIME,
+        AGX,
+        AGY,
+        AGZ
+    };
+
+    /**
+     * Decoded Tello state. Every field is 32 bit wide, so a sample maps
+     * directly onto fixed-width columns.
+     */
+    struct EXPORT StatusSample {
+        int32_t _mid = -1;
+        int32_t _x = 0;
+        int32_t _y = 0;
+        int32_t _z = 0;
+        int32_t _pitch = 0;
+        int32_t _roll = 0;
+        int32_t _yaw = 0;
+        int32_t _vgx = 0;
+        int32_t _vgy = 0;
+        int32_t _vgz = 0;
+        int32_t _templ = 0;
+        int32_t _temph = 0;
+        int32_t _tof = 0;
+        int32_t _h = 0;
+        int32_t _bat = 0;
+        float _baro = 0.0f;
+        int32_t _time = 0;
+        float _agx = 0.0f;
+        float _agy = 0.0f;
+        float _agz = 0.0f;
+
+        [[nodiscard]] double value(StatusField field) const;
+
+        /**
+         * Raw 32 bit column word of the field (two's complement or IEEE-754).
+         */
+        [[nodiscard]] uint32_t bits(StatusField field) const;
+        void setBits(StatusField field, uint32_t bits);
+
+        /**
+         * Parses a state datagram without allocating.
+         * Unknown keys are skipped, missing keys keep their default.
+         * @return true, if at least one known key was found
+         */
+        static bool parse(const char* data, size_t length, StatusSample& sample);
+    };
+
+    EXPORT bool isFloatField(StatusField field);
+    EXPORT const char* fieldName(StatusField field);
+    EXPORT optional<StatusField> fieldByName(const string& name);
+}
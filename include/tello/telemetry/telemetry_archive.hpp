@@ -0,0 +1,128 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+#define TELEMETRY_ARCHIVE_BLOCK_CAPACITY 1024
+
+using ip_address = unsigned long;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace tello {
+
+    class MemoryMapInterface;
+    class TelemetryReader;
+
+    using FieldSelection = std::bitset<STATUS_FIELD_COUNT>;
+
+    /**
+     * Index entry of an archive block. The index is stored at the end of the archive,
+     * so blocks can be skipped or decoded independently of each other.
+     */
+    struct EXPORT TelemetryBlockIndex {
+        uint64_t _offset;
+        uint64_t _size;
+        uint32_t _count;
+        uint32_t _reserved;
+        int64_t _firstTimestamp;
+        int64_t _lastTimestamp;
+        double _min[STATUS_FIELD_COUNT];
+        double _max[STATUS_FIELD_COUNT];
+    };
+
+    /**
+     * Decoded columns of an archive block. Columns which were not selected stay empty.
+     */
+    struct EXPORT TelemetryColumns {
+        size_t _count = 0;
+        vector<int64_t> _timestamps;
+        vector<uint32_t> _columns[STATUS_FIELD_COUNT];
+
+        [[nodiscard]] double value(StatusField field, size_t index) const;
+    };
+
+    /**
+     * Writes status samples of one drone into a compressed archive ('.tta').
+     * Timestamps are delta-of-delta encoded, integer fields zig-zag varint delta encoded
+     * and float fields XOR encoded.
+     */
+    class EXPORT TelemetryArchiveWriter {
+    public:
+        explicit TelemetryArchiveWriter(unsigned int blockCapacity = TELEMETRY_ARCHIVE_BLOCK_CAPACITY);
+        TelemetryArchiveWriter(const TelemetryArchiveWriter&) = delete;
+        TelemetryArchiveWriter& operator=(const TelemetryArchiveWriter&) = delete;
+        ~TelemetryArchiveWriter();
+
+        bool open(const string& path, ip_address drone);
+        bool append(int64_t timestamp, const StatusSample& sample);
+
+        /**
+         * Encodes the pending block and writes the block index.
+         */
+        bool close();
+
+        /**
+         * Size of the appended samples as fixed-width columns.
+         */
+        [[nodiscard]] unsigned long long rawBytes() const;
+        [[nodiscard]] unsigned long long encodedBytes() const;
+
+        /**
+         * Converts a recording of the TelemetryRecorder into an archive.
+         */
+        static bool convert(const TelemetryReader& reader, const string& path,
+                            unsigned int blockCapacity = TELEMETRY_ARCHIVE_BLOCK_CAPACITY);
+
+    private:
+        const unsigned int _blockCapacity;
+        std::ofstream _out;
+        ip_address _drone;
+        vector<int64_t> _timestamps;
+        vector<uint32_t> _columns[STATUS_FIELD_COUNT];
+        vector<TelemetryBlockIndex> _index;
+        vector<uint8_t> _buffer;
+        unsigned long long _rawBytes;
+        unsigned long long _encodedBytes;
+
+        bool writeBlock();
+    };
+
+    /**
+     * Reads an archive through a read-only memory mapping. Decoding is const and thread safe,
+     * so blocks may be decoded in parallel.
+     */
+    class EXPORT TelemetryArchiveReader {
+    public:
+        TelemetryArchiveReader();
+        TelemetryArchiveReader(const TelemetryArchiveReader&) = delete;
+        TelemetryArchiveReader& operator=(const TelemetryArchiveReader&) = delete;
+        ~TelemetryArchiveReader();
+
+        bool open(const string& path);
+        void close();
+
+        [[nodiscard]] ip_address drone() const;
+        [[nodiscard]] size_t blockCount() const;
+        [[nodiscard]] const TelemetryBlockIndex& index(size_t block) const;
+        [[nodiscard]] unsigned long long sampleCount() const;
+
+        /**
+         * Decodes the selected columns of a block. Not selected columns are skipped without decoding.
+         */
+        bool decode(size_t block, TelemetryColumns& columns, const FieldSelection& fields = FieldSelection().set(),
+                    bool timestamps = true) const;
+
+    private:
+        unique_ptr<MemoryMapInterface> _map;
+        const TelemetryBlockIndex* _index;
+        size_t _blockCount;
+    };
+}
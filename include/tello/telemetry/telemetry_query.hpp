@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "status_sample.hpp"
+#include "telemetry_archive.hpp"
+#include "../macro_definition.hpp"
+
+using ip_address = unsigned long;
+using std::string;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+
+namespace tello::threading {
+    class Threadpool;
+}
+
+namespace tello {
+
+    /**
+     * Inclusive value range a field has to be in.
+     */
+    struct EXPORT TelemetryPredicate {
+        StatusField _field;
+        double _min;
+        double _max;
+    };
+
+    struct EXPORT TelemetryQuery {
+        /**
+         * Time range [from, to) in microseconds. With '_relativeTime' the range is relative
+         * to the first sample of every recording.
+         */
+        int64_t _from = std::numeric_limits<int64_t>::min();
+        int64_t _to = std::numeric_limits<int64_t>::max();
+        bool _relativeTime = false;
+
+        /**
+         * All predicates have to match for a sample to be aggregated.
+         */
+        vector<TelemetryPredicate> _predicates;
+
+        /**
+         * Fields which are aggregated. Only these and the predicate fields are decoded.
+         */
+        FieldSelection _fields;
+    };
+
+    struct EXPORT FieldAggregate {
+        unsigned long long _count = 0;
+        double _min = std::numeric_limits<double>::max();
+        double _max = std::numeric_limits<double>::lowest();
+        double _sum = 0.0;
+        double _first = 0.0;
+        double _last = 0.0;
+        int64_t _firstTimestamp = std::numeric_limits<int64_t>::max();
+        int64_t _lastTimestamp = std::numeric_limits<int64_t>::min();
+
+        [[nodiscard]] double mean() const;
+
+        /**
+         * Change per second between the first and the last matching sample.
+         */
+        [[nodiscard]] double rate() const;
+
+        void merge(const FieldAggregate& other);
+    };
+
+    struct EXPORT TelemetryAggregate {
+        unsigned long long _samples = 0;
+        FieldAggregate _fields[STATUS_FIELD_COUNT];
+
+        void merge(const TelemetryAggregate& other);
+    };
+
+    struct EXPORT RecordingAggregate {
+        string _path;
+        ip_address _drone;
+        TelemetryAggregate _aggregate;
+    };
+
+    struct EXPORT TelemetryQueryResult {
+        vector<RecordingAggregate> _recordings;
+        unordered_map<ip_address, TelemetryAggregate> _drones;
+        vector<string> _failed;
+
+        unsigned long long _blocksScanned = 0;
+        unsigned long long _blocksSkipped = 0;
+        unsigned long long _samplesScanned = 0;
+    };
+
+    /**
+     * Scans recorded telemetry (archives '.tta' and columnar recordings '.tcol') in parallel.
+     * Time ranges and predicates are checked against the block indexes first,
+     * so blocks which cannot match are neither read nor decoded.
+     */
+    class EXPORT TelemetryQueryEngine {
+    public:
+        explicit TelemetryQueryEngine(unsigned int threads = std::thread::hardware_concurrency());
+        TelemetryQueryEngine(const TelemetryQueryEngine&) = delete;
+        TelemetryQueryEngine& operator=(const TelemetryQueryEngine&) = delete;
+        ~TelemetryQueryEngine();
+
+        TelemetryQueryResult run(const vector<string>& recordings, const TelemetryQuery& query);
+
+    private:
+        unique_ptr<threading::Threadpool> _threadpool;
+    };
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+using ip_address = unsigned long;
+using std::string;
+using std::unique_ptr;
+
+namespace tello {
+
+    class MemoryMapInterface;
+
+    /**
+     * View on one block of a columnar telemetry file. The columns point directly into the mapping.
+     */
+    class EXPORT TelemetryBlock {
+    public:
+        [[nodiscard]] unsigned int count() const;
+        [[nodiscard]] int64_t firstTimestamp() const;
+        [[nodiscard]] int64_t lastTimestamp() const;
+        [[nodiscard]] double min(StatusField field) const;
+        [[nodiscard]] double max(StatusField field) const;
+
+        [[nodiscard]] const int64_t* timestamps() const;
+
+        /**
+         * @return column of an integer field or nullptr for a float field
+         */
+        [[nodiscard]] const int32_t* intColumn(StatusField field) const;
+
+        /**
+         * @return column of a float field or nullptr for an integer field
+         */
+        [[nodiscard]] const float* floatColumn(StatusField field) const;
+
+        [[nodiscard]] double value(StatusField field, unsigned int index) const;
+        [[nodiscard]] StatusSample sample(unsigned int index) const;
+
+    private:
+        friend class TelemetryReader;
+
+        TelemetryBlock(const char* block, unsigned int capacity);
+
+        const char* _block;
+        unsigned int _capacity;
+    };
+
+    /**
+     * Zero-copy reader of a file written by the TelemetryRecorder.
+     */
+    class EXPORT TelemetryReader {
+    public:
+        TelemetryReader();
+        TelemetryReader(const TelemetryReader&) = delete;
+        TelemetryReader& operator=(const TelemetryReader&) = delete;
+        ~TelemetryReader();
+
+        bool open(const string& path);
+        void close();
+
+        [[nodiscard]] ip_address drone() const;
+        [[nodiscard]] size_t blockCount() const;
+        [[nodiscard]] TelemetryBlock block(size_t index) const;
+        [[nodiscard]] unsigned long long sampleCount() const;
+
+    private:
+        unique_ptr<MemoryMapInterface> _map;
+        size_t _blockCount;
+    };
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+#define TELEMETRY_BLOCK_CAPACITY 600
+#define TELEMETRY_QUEUE_CAPACITY 4096
+
+using ip_address = unsigned long;
+using std::string;
+using std::thread;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+
+namespace tello::telemetry {
+    class ColumnarWriter;
+}
+
+namespace tello {
+
+    /**
+     * Records decoded status samples per drone into append-only, memory mapped columnar files
+     * ('<directory>/telemetry_<ip>.tcol'). Samples are handed over to a dedicated writer thread,
+     * so recording never blocks the status listener.
+     */
+    class EXPORT TelemetryRecorder {
+    public:
+        explicit TelemetryRecorder(string directory, unsigned int blockCapacity = TELEMETRY_BLOCK_CAPACITY);
+        TelemetryRecorder(const TelemetryRecorder&) = delete;
+        TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+        TelemetryRecorder(TelemetryRecorder&&) = delete;
+        TelemetryRecorder& operator=(TelemetryRecorder&&) = delete;
+        ~TelemetryRecorder();
+
+        /**
+         * Queues a sample for writing.
+         * @param timestamp receive time in microseconds since epoch
+         * @return false, if the queue is full and the sample was dropped
+         */
+        bool record(ip_address drone, int64_t timestamp, const StatusSample& sample);
+
+        /**
+         * Writes all queued samples and stops the writer thread.
+         */
+        void stop();
+
+        [[nodiscard]] unsigned long long recorded() const;
+        [[nodiscard]] unsigned long long dropped() const;
+
+        [[nodiscard]] static string path(const string& directory, ip_address drone);
+
+    private:
+        struct PendingSample {
+            ip_address _drone;
+            int64_t _timestamp;
+            StatusSample _sample;
+        };
+
+        const string _directory;
+        const unsigned int _blockCapacity;
+
+        vector<PendingSample> _pending;
+        std::mutex _pendingMutex;
+        std::condition_variable _pendingCondition;
+        bool _running;
+        std::atomic<unsigned long long> _recorded;
+        std::atomic<unsigned long long> _dropped;
+
+        unordered_map<ip_address, unique_ptr<telemetry::ColumnarWriter>> _writers;
+        thread _worker;
+
+        void write();
+        void write(const vector<PendingSample>& samples);
+    };
+}
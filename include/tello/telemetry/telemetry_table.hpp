@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "status_sample.hpp"
+#include "../macro_definition.hpp"
+
+#define TELEMETRY_TABLE_SLOTS 16
+
+using ip_address = unsigned long;
+using std::optional;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace tello {
+
+    class MemoryMapInterface;
+
+    /**
+     * Latest status of every drone in a memory mapped file, which other local processes read
+     * with the TelemetryTableReader without binding the status port.
+     * Only the status listener updates the table.
+     */
+    class EXPORT TelemetryTable {
+    public:
+        explicit TelemetryTable(const string& path, uint32_t slots = TELEMETRY_TABLE_SLOTS);
+        TelemetryTable(const TelemetryTable&) = delete;
+        TelemetryTable& operator=(const TelemetryTable&) = delete;
+        ~TelemetryTable();
+
+        /**
+         * @param timestamp receive time in microseconds since epoch
+         * @return false, if the table is not available or full
+         */
+        bool update(ip_address drone, int64_t timestamp, const StatusSample& sample);
+
+    private:
+        unique_ptr<MemoryMapInterface> _map;
+        uint32_t _slots;
+    };
+
+    struct EXPORT TelemetrySnapshot {
+        ip_address _drone;
+        int64_t _timestamp;
+        /**
+         * Number of updates of the slot
+         */
+        uint64_t _updates;
+        StatusSample _sample;
+    };
+
+    /**
+     * Read-only client of the telemetry table, usable from another process.
+     * Reading a drone copies its slot without a system call or lock.
+     */
+    class EXPORT TelemetryTableReader {
+    public:
+        TelemetryTableReader();
+        TelemetryTableReader(const TelemetryTableReader&) = delete;
+        TelemetryTableReader& operator=(const TelemetryTableReader&) = delete;
+        ~TelemetryTableReader();
+
+        bool open(const string& path);
+        void close();
+
+        [[nodiscard]] vector<ip_address> drones() const;
+
+        /**
+         * @return empty, if the drone has not sent a status yet
+         */
+        [[nodiscard]] optional<TelemetrySnapshot> read(ip_address drone) const;
+
+    private:
+        unique_ptr<MemoryMapInterface> _map;
+    };
+}
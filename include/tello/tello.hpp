@@ -6,35 +6,135 @@
 #include "response/status_response.hpp"
 #include <shared_mutex>
 #include "response/video_response.hpp"
+#include "response/nal_unit_response.hpp"
 #include "tello_interface.hpp"
 #include <future>
+#include <chrono>
 #include <functional>
 #include "macro_definition.hpp"
+#include "telemetry/status_filter.hpp"
+#include "telemetry/status_queue.hpp"
+#include "subscription.hpp"
+#include "latency_histogram.hpp"
+#include "video/video_queue.hpp"
+#include "video/gop_cache.hpp"
+#include "video/video_health.hpp"
+#include "executor.hpp"
 
 using std::shared_ptr;
 using std::unordered_map;
 using tello::StatusResponse;
 using tello::NetworkData;
 using tello::VideoResponse;
+using tello::NalUnitResponse;
 using std::future;
 
+#define VIDEO_DEMAND_STREAMOFF_DELAY_MS 5000
+
 namespace tello {
 
     class Command;
     class Response;
     class Network;
     class QueryResponse;
+    class TelemetryRecorder;
+    class TelemetryTable;
+    class VideoRecorder;
+    class VideoRingPublisher;
 
     using status_handler = std::function<void(const StatusResponse& status)>;
     using video_handler = std::function<void(const VideoResponse& frame)>;
+    using nal_unit_handler = std::function<void(const NalUnitResponse& nalUnit)>;
+
+    namespace video {
+        class VideoDemand;
+    }
+
+    namespace threading {
+        template<typename Subscriber>
+        class SubscriberList;
+    }
+
+    struct StatusSubscriber {
+        status_handler _handler;
+        StatusFilter _filter;
+    };
 
     class EXPORT Tello : public TelloInterface<future<Response>, future<QueryResponse>> {
     public:
         explicit Tello(ip_address telloIp);
         ~Tello();
 
-        void setStatusHandler(status_handler statusHandler);
+        /**
+         * Replaces the handler set by a previous call. Further handlers can be added with 'subscribeStatus'.
+         * @param statusFilter rejects status updates before the handler is called
+         */
+        void setStatusHandler(status_handler statusHandler, const StatusFilter& statusFilter = StatusFilter());
         void setVideoHandler(video_handler videoHandler);
+
+        /**
+         * Adds a status handler. It is called until the returned token is destroyed or unsubscribed.
+         */
+        [[nodiscard]] Subscription
+        subscribeStatus(status_handler statusHandler, const StatusFilter& statusFilter = StatusFilter());
+        /**
+         * @param primeWithGop the handler gets the cached group of pictures before the first live frame,
+         * so it can decode immediately instead of waiting for the next keyframe. The first call turns on the cache,
+         * from then on it holds up to GOP_CACHE_MAX_FRAMES frame buffers.
+         */
+        [[nodiscard]] Subscription subscribeVideo(video_handler videoHandler, bool primeWithGop = false);
+
+        /**
+         * Latest keyframe, shared with the cache. The first call turns on caching the keyframe,
+         * so it returns an empty handle until the next keyframe.
+         */
+        [[nodiscard]] FrameHandle videoSnapshot() const;
+
+        /**
+         * Low latency video: the handler gets every NAL unit on the video listener thread, as soon as it is complete,
+         * without waiting for the rest of the frame. It has to return quickly.
+         */
+        [[nodiscard]] Subscription subscribeNalUnits(nal_unit_handler nalUnitHandler);
+
+        /**
+         * Latency from the receipt of the packet completing a NAL unit until its handlers are called
+         */
+        [[nodiscard]] const LatencyHistogram& nalUnitLatency() const;
+
+        /**
+         * Bounds the frames waiting for the video handlers of this drone
+         */
+        void setVideoQueue(size_t capacity, VideoDropPolicy policy);
+
+        /**
+         * Bounds the status updates waiting for the status handlers of this drone
+         */
+        void setStatusQueue(size_t capacity, StatusDropPolicy policy);
+        [[nodiscard]] StatusQueueStatistics statusQueueStatistics() const;
+
+        /**
+         * Executor of the status and video handlers of this drone, nullptr uses the executor of the TelloNetwork
+         */
+        void setExecutor(shared_ptr<Executor> executor);
+        [[nodiscard]] VideoQueueStatistics videoQueueStatistics() const;
+
+        /**
+         * Packet, frame and rate statistics of the video stream, e.g. to lower the resolution or change the channel
+         */
+        [[nodiscard]] VideoHealthStatistics videoHealth() const;
+
+        /**
+         * Opt-in: 'streamon' is sent, when the first video or NAL unit handler subscribes, 'streamoff' once
+         * no handler was left for 'streamoffDelay'. Without handlers, received video is discarded unprocessed.
+         * Recorders, rings and the GOP cache do not keep the stream alive.
+         */
+        void setVideoOnDemand(bool enabled,
+                              std::chrono::milliseconds streamoffDelay = std::chrono::milliseconds(
+                                      VIDEO_DEMAND_STREAMOFF_DELAY_MS));
+        void setTelemetryRecorder(shared_ptr<TelemetryRecorder> telemetryRecorder);
+        void setTelemetryTable(shared_ptr<TelemetryTable> telemetryTable);
+        void setVideoRecorder(shared_ptr<VideoRecorder> videoRecorder);
+        void setVideoRing(shared_ptr<VideoRingPublisher> videoRing);
         [[nodiscard]] ip_address ip() const;
 
         /////////////////////////////////////////////////////////////
@@ -82,7 +182,21 @@ namespace tello {
         static NetworkData mapToNetworkData(ip_address telloIp);
 
         const NetworkData _clientaddr;
-        status_handler _statusHandler;
-        video_handler _videoHandler;
+        shared_ptr<threading::SubscriberList<StatusSubscriber>> _statusSubscribers;
+        shared_ptr<threading::SubscriberList<video_handler>> _videoSubscribers;
+        shared_ptr<threading::SubscriberList<nal_unit_handler>> _nalUnitSubscribers;
+        shared_ptr<LatencyHistogram> _nalUnitLatency;
+        shared_ptr<VideoQueue> _videoQueue;
+        shared_ptr<StatusQueue> _statusQueue;
+        shared_ptr<GopCache> _gopCache;
+        shared_ptr<VideoHealth> _videoHealth;
+        shared_ptr<video::VideoDemand> _videoDemand;
+        shared_ptr<Executor> _executor;
+        Subscription _statusHandlerSubscription;
+        Subscription _videoHandlerSubscription;
+        shared_ptr<TelemetryRecorder> _telemetryRecorder;
+        shared_ptr<TelemetryTable> _telemetryTable;
+        shared_ptr<VideoRecorder> _videoRecorder;
+        shared_ptr<VideoRingPublisher> _videoRing;
     };
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include "../macro_definition.hpp"
+#include "h264.hpp"
+
+using std::shared_ptr;
+
+namespace tello {
+
+    class FrameBuffer;
+    class FrameHandle;
+
+    namespace video {
+        class FramePool;
+    }
+
+    /**
+     * Takes back a frame buffer, when the last handle to it is dropped
+     */
+    class FrameRecycler {
+    public:
+        virtual ~FrameRecycler() = default;
+        virtual void recycle(FrameBuffer* frame) = 0;
+    };
+
+    /**
+     * Contiguous buffer a video frame is reassembled in.
+     * Packets are received directly behind the committed bytes ('tail').
+     */
+    class EXPORT FrameBuffer {
+    public:
+        explicit FrameBuffer(size_t capacity);
+        FrameBuffer(const FrameBuffer&) = delete;
+        FrameBuffer& operator=(const FrameBuffer&) = delete;
+        ~FrameBuffer();
+
+        [[nodiscard]] const unsigned char* data() const;
+        [[nodiscard]] size_t length() const;
+        [[nodiscard]] size_t capacity() const;
+
+        [[nodiscard]] unsigned char* tail();
+        [[nodiscard]] size_t available() const;
+
+        /**
+         * Grows the buffer, so that at least 'available' bytes are free behind the committed bytes.
+         */
+        void reserve(size_t available);
+        void commit(size_t length);
+        void truncate(size_t length);
+        void clear();
+
+        [[nodiscard]] const FrameInfo& info() const;
+        void setInfo(const FrameInfo& info);
+
+        friend class FrameHandle;
+        friend class video::FramePool;
+
+    private:
+        unsigned char* _data;
+        size_t _capacity;
+        size_t _length;
+        FrameInfo _info;
+        std::atomic<unsigned int> _references;
+        shared_ptr<FrameRecycler> _recycler;
+    };
+}
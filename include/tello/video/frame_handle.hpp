@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include "frame_buffer.hpp"
+#include "../macro_definition.hpp"
+
+namespace tello {
+
+    /**
+     * Shared, read-only reference to a reassembled frame. Copying a handle only increments a counter,
+     * the buffer goes back to its pool when the last handle is dropped.
+     */
+    class EXPORT FrameHandle {
+    public:
+        FrameHandle() noexcept;
+
+        /**
+         * Takes the ownership of 'frame'. Without a recycler the buffer is deleted with the last handle.
+         */
+        explicit FrameHandle(FrameBuffer* frame) noexcept;
+        FrameHandle(const FrameHandle& other) noexcept;
+        FrameHandle& operator=(const FrameHandle& other) noexcept;
+        FrameHandle(FrameHandle&& other) noexcept;
+        FrameHandle& operator=(FrameHandle&& other) noexcept;
+        ~FrameHandle();
+
+        [[nodiscard]] const unsigned char* data() const;
+        [[nodiscard]] size_t length() const;
+        [[nodiscard]] const FrameInfo& info() const;
+        [[nodiscard]] unsigned int useCount() const;
+        explicit operator bool() const;
+
+        void reset();
+
+    private:
+        FrameBuffer* _frame;
+    };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "frame_handle.hpp"
+#include "../macro_definition.hpp"
+
+#define GOP_CACHE_MAX_FRAMES 64
+
+using std::vector;
+
+namespace tello {
+
+    /**
+     * What the cache keeps of the pushed frames
+     */
+    enum class GopCacheMode {
+        DISABLED = 0,
+        /**
+         * Latest keyframe for snapshots
+         */
+        KEYFRAME = 1,
+        /**
+         * Latest parameter sets and group of pictures
+         */
+        GOP = 2
+    };
+
+    /**
+     * Latest parameter sets and group of pictures (keyframe and its following frames) of one drone.
+     * The cache holds handles of the delivered frames, nothing is copied, so every cached frame keeps its pool buffer.
+     * A group growing beyond 'maxFrames' is no longer cached completely, only its keyframe is kept.
+     */
+    class EXPORT GopCache {
+    public:
+        explicit GopCache(size_t maxFrames = GOP_CACHE_MAX_FRAMES, GopCacheMode mode = GopCacheMode::GOP);
+        GopCache(const GopCache&) = delete;
+        GopCache& operator=(const GopCache&) = delete;
+
+        /**
+         * Ignored while disabled
+         */
+        void push(const FrameHandle& frame);
+        void clear();
+
+        /**
+         * Raises the mode to at least 'mode', it is never lowered. Frames are cached from the next keyframe on.
+         */
+        void require(GopCacheMode mode);
+        [[nodiscard]] GopCacheMode mode() const;
+
+        /**
+         * Bounds the cached group, e.g. below the preallocated frame buffers. A larger cached group is given up.
+         */
+        void limit(size_t maxFrames);
+
+        /**
+         * Latest keyframe, an empty handle before the first one
+         */
+        [[nodiscard]] FrameHandle snapshot() const;
+
+        /**
+         * Frames decodable in order: the latest parameter sets, if the keyframe lacks them,
+         * the keyframe and every following frame. Empty, if the group is not cached completely.
+         */
+        [[nodiscard]] vector<FrameHandle> gop() const;
+
+        /**
+         * Calls 'consumer' with the group, no frame is pushed meanwhile
+         */
+        void gop(const std::function<void(vector<FrameHandle>&&)>& consumer) const;
+
+    private:
+        mutable std::mutex _mutex;
+        size_t _maxFrames;
+        std::atomic<GopCacheMode> _mode;
+        FrameHandle _parameterSets;
+        vector<FrameHandle> _frames;
+        bool _complete;
+
+        [[nodiscard]] vector<FrameHandle> copyGop() const;
+    };
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "../macro_definition.hpp"
+
+namespace tello {
+
+    /**
+     * H.264 NAL unit types (ITU-T H.264, table 7-1) the video path cares about
+     */
+    enum class NalUnitType {
+        UNSPECIFIED = 0,
+        NON_IDR_SLICE = 1,
+        PARTITION_A = 2,
+        PARTITION_B = 3,
+        PARTITION_C = 4,
+        IDR_SLICE = 5,
+        SEI = 6,
+        SPS = 7,
+        PPS = 8,
+        ACCESS_UNIT_DELIMITER = 9,
+        END_OF_SEQUENCE = 10,
+        END_OF_STREAM = 11,
+        FILLER = 12
+    };
+
+    /**
+     * Stream properties taken from the sequence parameter set
+     */
+    struct EXPORT VideoFormat {
+        unsigned int _width = 0;
+        unsigned int _height = 0;
+        /**
+         * Frames per second from the VUI timing info, 0 if not signalled
+         */
+        double _frameRate = 0.0;
+        int _profile = 0;
+        int _level = 0;
+    };
+
+    /**
+     * Properties of one access unit (frame)
+     */
+    struct EXPORT FrameInfo {
+        bool _keyframe = false;
+        bool _reference = false;
+        bool _parameterSets = false;
+        /**
+         * Type of the first slice, of the first parameter set in a frame without slice
+         */
+        NalUnitType _nalType = NalUnitType::UNSPECIFIED;
+        unsigned int _nalUnits = 0;
+        VideoFormat _format;
+        /**
+         * Number of the delivered frame of the drone, starting with 1
+         */
+        uint64_t _sequence = 0;
+        /**
+         * Receive time of the first packet of the frame (microseconds of a monotonic clock)
+         */
+        int64_t _receiveTime = 0;
+    };
+
+    EXPORT NalUnitType nalUnitType(unsigned char header);
+    EXPORT bool isSlice(NalUnitType type);
+
+    /**
+     * Parses a sequence parameter set without decoding the stream.
+     * @param data NAL unit starting with the NAL header byte, without start code
+     * @return false, if the SPS is truncated or malformed
+     */
+    EXPORT bool parseSps(const unsigned char* data, size_t length, VideoFormat& format);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "frame_handle.hpp"
+#include "../native/network_interface.hpp"
+#include "../response/video_response.hpp"
+#include "../macro_definition.hpp"
+
+#define RTP_LOCALHOST (ip_address)0x7F000001 // 127.0.0.1
+
+using std::unique_ptr;
+using std::vector;
+
+namespace tello::video {
+    class RtpPacketizer;
+}
+
+namespace tello {
+
+    /**
+     * Re-streams the video of one drone as RTP (H.264, RFC 6184) to any number of UDP sinks,
+     * e.g. a player with an SDP file. The packets are sent straight out of the shared frame buffers.
+     * 'send' has to be called in frame order, e.g. from a video handler.
+     */
+    class EXPORT RtpStreamer {
+    public:
+        explicit RtpStreamer(uint32_t ssrc = 0x7E110000, uint8_t payloadType = 96);
+        RtpStreamer(const RtpStreamer&) = delete;
+        RtpStreamer& operator=(const RtpStreamer&) = delete;
+        ~RtpStreamer();
+
+        void addSink(unsigned short port, ip_address address = RTP_LOCALHOST);
+        void removeSink(unsigned short port, ip_address address = RTP_LOCALHOST);
+
+        /**
+         * Sends the frame to every sink, the RTP timestamp is the receive time of the frame
+         * @return false, if the socket is not available or a packet could not be sent
+         */
+        bool send(const FrameHandle& frame);
+        bool send(const VideoResponse& frame);
+
+        [[nodiscard]] unsigned long long packetsSent() const;
+        [[nodiscard]] unsigned long long sendErrors() const;
+
+    private:
+        unique_ptr<NetworkInterface> _networkInterface;
+        optional<ConnectionData> _connection;
+        unique_ptr<video::RtpPacketizer> _packetizer;
+        std::mutex _sinksMutex;
+        vector<NetworkData> _sinks;
+        std::atomic<unsigned long long> _packetsSent;
+        std::atomic<unsigned long long> _sendErrors;
+    };
+}
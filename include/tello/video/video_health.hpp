@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "../video_analyzer.hpp"
+#include "../macro_definition.hpp"
+
+#define VIDEO_HEALTH_WINDOW 32
+
+namespace tello {
+
+    /**
+     * Health of the video stream of one drone. Rates are measured over the last delivered frames,
+     * '_lastFrame' tells, whether they are still current.
+     */
+    struct EXPORT VideoHealthStatistics {
+        uint64_t _packets = 0;
+        uint64_t _bytes = 0;
+        uint64_t _frames = 0;
+        uint64_t _keyframes = 0;
+        uint64_t _framesDropped = 0;
+        uint64_t _lossEvents = 0;
+        uint64_t _corruptFrames = 0;
+        uint64_t _staleFrames = 0;
+        uint64_t _oversizeFrames = 0;
+        double _fps = 0.0;
+        /**
+         * Bits per second of the delivered frames
+         */
+        double _bitrate = 0.0;
+        /**
+         * Smoothed variation of the frame inter-arrival time in microseconds (RFC 3550 estimator)
+         */
+        double _jitter = 0.0;
+        /**
+         * Frames between the last two keyframes, 0 until two keyframes were received
+         */
+        uint64_t _keyframeInterval = 0;
+        /**
+         * Mean time from the first packet of a frame until it is complete (microseconds)
+         */
+        int64_t _reassemblyLatency = 0;
+        /**
+         * Completion time of the last frame (microseconds of a monotonic clock), 0 without frames
+         */
+        int64_t _lastFrame = 0;
+    };
+
+    /**
+     * Updated by the video listener thread, read by anyone.
+     * The listener holds the lock only to copy counters, so pulling the statistics is cheap.
+     */
+    class EXPORT VideoHealth {
+    public:
+        VideoHealth();
+        VideoHealth(const VideoHealth&) = delete;
+        VideoHealth& operator=(const VideoHealth&) = delete;
+
+        /**
+         * Reassembly counters of the drone after a received packet
+         */
+        void reassembly(const VideoStatistics& statistics);
+
+        /**
+         * @param firstPacket receive time of the first packet of the frame
+         * @param complete receive time of the packet completing the frame
+         */
+        void frame(size_t length, bool keyframe, int64_t firstPacket, int64_t complete);
+        void reset();
+
+        [[nodiscard]] VideoHealthStatistics statistics() const;
+
+    private:
+        struct FrameSample {
+            int64_t _complete;
+            size_t _length;
+            int64_t _latency;
+        };
+
+        mutable std::mutex _mutex;
+        VideoStatistics _reassembly;
+        FrameSample _window[VIDEO_HEALTH_WINDOW];
+        size_t _next;
+        size_t _count;
+        uint64_t _frames;
+        uint64_t _keyframes;
+        uint64_t _lastKeyframe;
+        uint64_t _keyframeInterval;
+        int64_t _lastInterval;
+        double _jitter;
+    };
+}
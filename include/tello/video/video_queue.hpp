@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include "frame_handle.hpp"
+#include "../macro_definition.hpp"
+
+#define VIDEO_QUEUE_CAPACITY 8
+
+namespace tello {
+
+    /**
+     * Frames given up, when the handlers of a drone cannot keep up
+     */
+    enum class VideoDropPolicy {
+        /**
+         * The oldest queued frame is dropped
+         */
+        DROP_OLDEST,
+        /**
+         * The oldest non-reference frame is dropped, no other frame depends on it.
+         * Without one the oldest frame is dropped.
+         */
+        DROP_NON_REFERENCE,
+        /**
+         * A keyframe replaces all queued frames. If the queue is full, frames are dropped until
+         * the next keyframe, so the handler only gets decodable frames.
+         */
+        LATEST_GOP
+    };
+
+    struct EXPORT VideoQueueStatistics {
+        size_t _depth = 0;
+        size_t _maxDepth = 0;
+        uint64_t _enqueued = 0;
+        uint64_t _delivered = 0;
+        uint64_t _dropped = 0;
+    };
+
+    /**
+     * Bounded queue of the frames of one drone, which wait for their handlers.
+     * A single task drains the queue, so the frames of a drone are delivered in order
+     * and a slow handler blocks at most one thread of the pool.
+     */
+    class EXPORT VideoQueue {
+    public:
+        explicit VideoQueue(size_t capacity = VIDEO_QUEUE_CAPACITY,
+                            VideoDropPolicy policy = VideoDropPolicy::DROP_OLDEST);
+        VideoQueue(const VideoQueue&) = delete;
+        VideoQueue& operator=(const VideoQueue&) = delete;
+
+        void configure(size_t capacity, VideoDropPolicy policy);
+
+        /**
+         * @return true, if the queue was idle and a task has to drain it
+         */
+        bool push(FrameHandle&& frame);
+
+        /**
+         * Next frame for the handlers. An empty handle ends the drain, the next push starts a new one.
+         */
+        [[nodiscard]] FrameHandle pop();
+
+        [[nodiscard]] VideoQueueStatistics statistics() const;
+
+    private:
+        mutable std::mutex _mutex;
+        std::deque<FrameHandle> _frames;
+        size_t _capacity;
+        VideoDropPolicy _policy;
+        bool _draining;
+        bool _waitForKeyframe;
+        VideoQueueStatistics _statistics;
+
+        void dropFull();
+    };
+}
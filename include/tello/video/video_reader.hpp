@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "h264.hpp"
+#include "../macro_definition.hpp"
+
+using ip_address = unsigned long;
+using std::optional;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace tello {
+
+    class MemoryMapInterface;
+
+    struct EXPORT VideoIndexEntry {
+        /**
+         * Receive time in microseconds since epoch
+         */
+        int64_t _timestamp = 0;
+        unsigned int _segment = 0;
+        uint64_t _offset = 0;
+        uint32_t _length = 0;
+        NalUnitType _type = NalUnitType::UNSPECIFIED;
+        bool _keyframe = false;
+        bool _parameterSets = false;
+    };
+
+    /**
+     * Zero-copy reader of the video recorded by a VideoRecorder session for one drone.
+     * Every segment and its index are memory mapped, seeking uses the keyframe tables without reading the video.
+     * Frames are numbered across all segments.
+     */
+    class EXPORT VideoReader {
+    public:
+        VideoReader();
+        VideoReader(const VideoReader&) = delete;
+        VideoReader& operator=(const VideoReader&) = delete;
+        ~VideoReader();
+
+        /**
+         * Maps the consecutive segments of 'drone' recorded in 'session', starting with the first one.
+         * @param session VideoRecorder::session() of the recording
+         * @return false, if there is no readable segment
+         */
+        bool open(const string& directory, ip_address drone, uint64_t session);
+
+        /**
+         * Maps the latest session of 'drone' in 'directory'
+         * @return false, if there is no readable segment
+         */
+        bool open(const string& directory, ip_address drone);
+        void close();
+
+        /**
+         * Sessions of 'drone' recorded in 'directory', oldest first
+         */
+        [[nodiscard]] static vector<uint64_t> sessions(const string& directory, ip_address drone);
+
+        [[nodiscard]] size_t segmentCount() const;
+        [[nodiscard]] size_t frameCount() const;
+        [[nodiscard]] size_t keyframeCount() const;
+        [[nodiscard]] VideoIndexEntry entry(size_t frame) const;
+
+        /**
+         * Frame to start decoding at, to show 'timestamp': the last keyframe received at or before it,
+         * or the parameter sets preceding that keyframe.
+         * @return empty, if no keyframe was received before 'timestamp'
+         */
+        [[nodiscard]] optional<size_t> seek(int64_t timestamp) const;
+
+        /**
+         * Annex-B bytes of a frame inside the mapping
+         */
+        [[nodiscard]] const unsigned char* frame(size_t frame, size_t& length) const;
+
+    private:
+        struct Segment;
+
+        vector<unique_ptr<Segment>> _segments;
+        /**
+         * Frame numbers of all keyframes in receive order
+         */
+        vector<size_t> _keyframes;
+        size_t _frameCount;
+
+        bool openSegment(const string& directory, ip_address drone, uint64_t session, unsigned int number);
+        [[nodiscard]] const Segment& segmentOf(size_t frame) const;
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "frame_handle.hpp"
+#include "../macro_definition.hpp"
+
+#define VIDEO_RECORDER_QUEUE_CAPACITY 256
+#define VIDEO_SEGMENT_DURATION_US (60LL * 1000 * 1000)
+#define VIDEO_SEGMENT_BYTES (256LL * 1024 * 1024)
+
+using ip_address = unsigned long;
+using std::string;
+using std::thread;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+
+namespace tello::video {
+    class SegmentWriter;
+}
+
+namespace tello {
+
+    /**
+     * A segment is closed at the first keyframe after one of the limits is reached
+     */
+    struct EXPORT VideoSegmentPolicy {
+        /**
+         * Receive time span of a segment in microseconds
+         */
+        int64_t _maxDuration = VIDEO_SEGMENT_DURATION_US;
+        int64_t _maxBytes = VIDEO_SEGMENT_BYTES;
+    };
+
+    /**
+     * Records the frames of every drone into segmented Annex-B files
+     * ('<directory>/video_<ip>_<session>_<segment>.h264') with a sidecar index ('.tvix') for the VideoReader.
+     * Every recorder is a new session, so it never overwrites the segments of an earlier one.
+     * Every segment starts with a keyframe and its parameter sets,
+     * so it can be played on its own. Frames are queued as shared handles without copying and are written
+     * in large batches by a dedicated writer thread, so recording never blocks the video listener.
+     */
+    class EXPORT VideoRecorder {
+    public:
+        explicit VideoRecorder(string directory, const VideoSegmentPolicy& policy = VideoSegmentPolicy());
+        VideoRecorder(const VideoRecorder&) = delete;
+        VideoRecorder& operator=(const VideoRecorder&) = delete;
+        VideoRecorder(VideoRecorder&&) = delete;
+        VideoRecorder& operator=(VideoRecorder&&) = delete;
+        ~VideoRecorder();
+
+        /**
+         * Queues a frame for writing.
+         * @param timestamp receive time in microseconds since epoch
+         * @return false, if the queue is full and the frame was dropped
+         */
+        bool record(ip_address drone, const FrameHandle& frame, int64_t timestamp);
+
+        /**
+         * Frames held at once, queued and being written, at most VIDEO_RECORDER_QUEUE_CAPACITY.
+         * With preallocated frame buffers, the recorder so never takes the buffers the video listener needs.
+         */
+        void limit(size_t maxFrames);
+
+        /**
+         * Writes all queued frames, closes the segments and stops the writer thread.
+         */
+        void stop();
+
+        [[nodiscard]] unsigned long long recorded() const;
+        [[nodiscard]] unsigned long long dropped() const;
+        [[nodiscard]] unsigned long long segments() const;
+
+        /**
+         * Start of the recording in microseconds since epoch, unique per process
+         */
+        [[nodiscard]] uint64_t session() const;
+
+        [[nodiscard]] static string path(const string& directory, ip_address drone, uint64_t session,
+                                         unsigned int segment);
+        [[nodiscard]] static string indexPath(const string& directory, ip_address drone, uint64_t session,
+                                              unsigned int segment);
+
+    private:
+        struct PendingFrame {
+            ip_address _drone;
+            int64_t _timestamp;
+            FrameHandle _frame;
+        };
+
+        const string _directory;
+        const VideoSegmentPolicy _policy;
+        const uint64_t _session;
+
+        vector<PendingFrame> _pending;
+        std::mutex _pendingMutex;
+        std::condition_variable _pendingCondition;
+        bool _running;
+        size_t _capacity;
+        size_t _writing;
+        std::atomic<unsigned long long> _recorded;
+        std::atomic<unsigned long long> _dropped;
+        std::atomic<unsigned long long> _segments;
+
+        unordered_map<ip_address, unique_ptr<video::SegmentWriter>> _writers;
+        thread _worker;
+
+        void write();
+        void write(vector<PendingFrame>& frames);
+
+        [[nodiscard]] static string segmentName(const string& directory, ip_address drone, uint64_t session,
+                                                unsigned int segment);
+    };
+}
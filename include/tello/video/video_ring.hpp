@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "frame_handle.hpp"
+#include "../macro_definition.hpp"
+
+#define VIDEO_RING_SLOTS 16
+#define VIDEO_RING_SLOT_CAPACITY (512 * 1024)
+
+using ip_address = unsigned long;
+using std::optional;
+using std::string;
+using std::unique_ptr;
+using std::unordered_map;
+
+namespace tello {
+
+    class MemoryMapInterface;
+    class AddressWaitInterface;
+
+    /**
+     * Publishes the frames of every drone into a shared memory ring ('<directory>/video_<ip>.tvring'),
+     * which any number of local processes map read-only with the VideoRingReader.
+     * A frame is copied once into the ring, readers get views without copying.
+     */
+    class EXPORT VideoRingPublisher {
+    public:
+        explicit VideoRingPublisher(string directory, uint32_t slots = VIDEO_RING_SLOTS,
+                                    uint64_t slotCapacity = VIDEO_RING_SLOT_CAPACITY);
+        VideoRingPublisher(const VideoRingPublisher&) = delete;
+        VideoRingPublisher& operator=(const VideoRingPublisher&) = delete;
+        ~VideoRingPublisher();
+
+        /**
+         * @param timestamp receive time in microseconds since epoch
+         * @return false, if the ring is not available or the frame exceeds a slot
+         */
+        bool publish(ip_address drone, const FrameHandle& frame, int64_t timestamp);
+
+        [[nodiscard]] unsigned long long published() const;
+        [[nodiscard]] unsigned long long dropped() const;
+
+        [[nodiscard]] static string path(const string& directory, ip_address drone);
+
+    private:
+        const string _directory;
+        const uint32_t _slots;
+        const uint64_t _slotCapacity;
+        std::mutex _mutex;
+        unique_ptr<AddressWaitInterface> _wait;
+        unordered_map<ip_address, unique_ptr<MemoryMapInterface>> _rings;
+        unsigned long long _published;
+        unsigned long long _dropped;
+
+        MemoryMapInterface* ringOf(ip_address drone);
+    };
+
+    /**
+     * Frame inside the shared ring. The publisher may overwrite it at any time,
+     * 'VideoRingReader::valid' tells, if the bytes read so far were intact.
+     */
+    struct EXPORT VideoRingFrame {
+        uint64_t _sequence;
+        int64_t _timestamp;
+        bool _keyframe;
+        const unsigned char* _data;
+        size_t _length;
+    };
+
+    /**
+     * Read-only client of the video ring of one drone, usable from another process.
+     */
+    class EXPORT VideoRingReader {
+    public:
+        VideoRingReader();
+        VideoRingReader(const VideoRingReader&) = delete;
+        VideoRingReader& operator=(const VideoRingReader&) = delete;
+        ~VideoRingReader();
+
+        bool open(const string& directory, ip_address drone);
+        void close();
+
+        /**
+         * Sequence of the latest published frame, 0 before the first one
+         */
+        [[nodiscard]] uint64_t latest() const;
+
+        /**
+         * @return empty, if the frame is not published yet or already overwritten
+         */
+        [[nodiscard]] optional<VideoRingFrame> frame(uint64_t sequence) const;
+        [[nodiscard]] bool valid(const VideoRingFrame& frame) const;
+
+        /**
+         * Sleeps until frame 'sequence' is published, woken by the publisher (futex on Linux, polling elsewhere)
+         * @return false on timeout (microseconds)
+         */
+        bool waitFor(uint64_t sequence, int64_t timeout) const;
+
+    private:
+        unique_ptr<MemoryMapInterface> _map;
+        unique_ptr<AddressWaitInterface> _wait;
+    };
+}
@@ -1,38 +1,141 @@
 #pragma once
 
-#include <vector>
 #include <unordered_map>
-#include <string>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "video/frame_handle.hpp"
+#include "macro_definition.hpp"
+
+#define VIDEO_MAX_FRAME_LENGTH (1024 * 1024)
+#define VIDEO_STALE_TIMEOUT_US 200000
 
-using std::vector;
 using std::unordered_map;
-using std::string;
 using std::shared_ptr;
 using ip_address = unsigned long;
 
 namespace tello {
 
-    class NetworkResponse;
+    struct DroneStream;
+
+    /**
+     * Bounds of the reassembly of one drone
+     */
+    struct EXPORT VideoLimits {
+        /**
+         * Frames growing beyond are discarded
+         */
+        size_t _maxFrameLength = VIDEO_MAX_FRAME_LENGTH;
+        /**
+         * A partial frame is discarded, if its next packet arrives later (microseconds)
+         */
+        int64_t _staleTimeout = VIDEO_STALE_TIMEOUT_US;
+        /**
+         * Tello starts every frame with a new packet. A frame starting inside a packet means a lost frame end.
+         */
+        bool _packetAlignedFrames = true;
+    };
+
+    /**
+     * Reassembly counters of one drone
+     */
+    struct EXPORT VideoStatistics {
+        uint64_t _packets = 0;
+        uint64_t _bytesReceived = 0;
+        uint64_t _framesDelivered = 0;
+        uint64_t _framesDropped = 0;
+        uint64_t _bytesDropped = 0;
+        uint64_t _lossEvents = 0;
+        uint64_t _oversizeFrames = 0;
+        uint64_t _staleFrames = 0;
+        uint64_t _corruptFrames = 0;
+        /**
+         * Complete frames or received packets dropped, because no buffer was free in real-time mode
+         */
+        uint64_t _poolExhausted = 0;
+        /**
+         * Frames dropped in real-time mode, because they outgrew their buffer, which must not reallocate
+         */
+        uint64_t _capacityExceeded = 0;
+    };
+
+    /**
+     * Gets the NAL units of every drone on the video listener thread, as soon as their end is received.
+     * NAL units are skipped while frames are discarded until the next IDR frame.
+     * A frame found corrupt at its end may already have passed some of its NAL units.
+     */
+    class NalUnitSink {
+    public:
+        virtual ~NalUnitSink() = default;
 
+        /**
+         * @param data NAL unit including its start code, only valid during the call
+         * @param receiveTime receive time of the packet completing the NAL unit
+         */
+        virtual void nalUnit(ip_address address, const unsigned char* data, size_t length, bool lastInFrame,
+                             int64_t receiveTime) = 0;
+    };
+
+    /**
+     * Reassembles the video frames of every drone in a pooled, contiguous buffer.
+     * Frames end on access unit boundaries of the Annex-B stream, a packet shorter than
+     * the maximal video packet only flushes a frame early.
+     *
+     * After a loss (lost frame start or end, stale or oversized frame) frames are discarded
+     * until the next IDR frame, so decoders never get frames referencing missing data.
+     * Only the video listener thread may call the methods.
+     */
     class VideoAnalyzer {
     public:
         VideoAnalyzer();
+        explicit VideoAnalyzer(shared_ptr<video::FramePool> pool, const VideoLimits& limits = VideoLimits(),
+                               NalUnitSink* nalUnitSink = nullptr);
         VideoAnalyzer(const VideoAnalyzer&) = delete;
         VideoAnalyzer& operator=(const VideoAnalyzer&) = delete;
         VideoAnalyzer(VideoAnalyzer&&) = delete;
         VideoAnalyzer& operator=(VideoAnalyzer&&) = delete;
         ~VideoAnalyzer();
 
-        bool append(NetworkResponse& response);
-        [[nodiscard]] unsigned char* frame(ip_address address) const;
-        [[nodiscard]] unsigned int length(ip_address address) const;
+        /**
+         * Free space behind the frame of 'address' to receive the next packet into.
+         * Without a frame of 'address' (unknown drone, no free buffer) a scratch buffer is returned.
+         */
+        [[nodiscard]] unsigned char* receiveBuffer(ip_address address, size_t& available);
+
+        /**
+         * Appends a packet, which was received into the receive buffer of 'expected'.
+         * If the packet came from another drone, it is moved to the frame of 'sender'.
+         * Without a free buffer for 'sender' the packet is dropped.
+         * @param now receive time in microseconds of a monotonic clock
+         * @return true, if the frame of 'sender' is complete and can be taken
+         */
+        bool commit(ip_address expected, ip_address sender, size_t length, int64_t now);
+
+        /**
+         * Detaches the complete frame of 'address' as immutable frame.
+         * Bytes of the next frame are moved to a new buffer.
+         * @return an empty handle, if no frame is complete. Call until empty, a packet may complete several frames.
+         */
+        [[nodiscard]] FrameHandle take(ip_address address);
         void clean(ip_address address);
 
-    private:
+        [[nodiscard]] VideoStatistics statistics(ip_address address) const;
 
-        unordered_map<ip_address, shared_ptr<vector<NetworkResponse>>> _frames;
+    private:
+        shared_ptr<video::FramePool> _pool;
+        const VideoLimits _limits;
+        NalUnitSink* const _nalUnitSink;
+        unordered_map<ip_address, std::unique_ptr<DroneStream>> _streams;
+        /**
+         * Receives packets, which have no frame to go to
+         */
+        std::unique_ptr<FrameBuffer> _scratch;
 
-        static bool isStart(const char* const& framePart, int length);
+        DroneStream& streamOf(ip_address address);
+        FrameBuffer* bufferOf(ip_address address);
+        bool attach(DroneStream& stream);
+        void makeRoom(DroneStream& stream, size_t length);
+        bool findComplete(DroneStream& stream) const;
+        static void discard(DroneStream& stream);
     };
-}
\ No newline at end of file
+}
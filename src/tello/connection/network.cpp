@@ -1,6 +1,20 @@
 #include "network.hpp"
 #include <tello/tello.hpp>
 #include "../native/network_interface_factory.hpp"
+#include "../native/thread_control_interface.hpp"
+#include "../native/thread_control_factory.hpp"
+#include <tello/telemetry/status_sample.hpp>
+#include <tello/telemetry/telemetry_recorder.hpp>
+#include <tello/telemetry/telemetry_table.hpp>
+#include <tello/video/video_recorder.hpp>
+#include <tello/video/video_ring.hpp>
+#include <chrono>
+#include <algorithm>
+#include "../thread/subscriber_list.hpp"
+#include "../thread/thread_pool_executor.hpp"
+#include <tello/video/frame_handle.hpp>
+#include "../video/frame_pool.hpp"
+#include "../video/video_demand.hpp"
 
 #define COMMAND_PORT 8889
 #define STATUS_PORT 8890
@@ -8,22 +22,35 @@
 
 using tello::Response;
 using tello::NetworkResponse;
+using tello::StatusSample;
+using tello::StatusSubscriber;
+using tello::video::FramePool;
+using tello::threading::ThreadPoolExecutor;
+using tello::QueuedStatus;
 
 ConnectionData tello::Network::_commandConnection{-1, {}};
 ConnectionData tello::Network::_statusConnection = {-1, {}};
 ConnectionData tello::Network::_videoConnection = {-1, {}};
 std::shared_mutex tello::Network::_connectionMutex;
 shared_ptr<NetworkInterface> tello::Network::networkInterface = tello::NetworkInterfaceFactory::build();
-VideoAnalyzer tello::Network::_videoAnalyzer;
+tello::Network::NalUnitDispatcher tello::Network::_nalUnitDispatcher;
+shared_ptr<FramePool> tello::Network::_framePool = std::make_shared<FramePool>();
+VideoAnalyzer tello::Network::_videoAnalyzer{_framePool, VideoLimits(), &_nalUnitDispatcher};
 Threadpool tello::Network::_threadpool;
+tello::LatencyHistogram tello::Network::_wakeupLatency;
+std::atomic<size_t> tello::Network::_gopCacheFrames{GOP_CACHE_MAX_FRAMES};
+std::atomic<size_t> tello::Network::_recorderFrames{VIDEO_RECORDER_QUEUE_CAPACITY};
+shared_ptr<tello::Executor> tello::Network::_defaultExecutor = std::make_shared<ThreadPoolExecutor>(_threadpool);
+shared_ptr<tello::Executor> tello::Network::_executor = _defaultExecutor;
 UdpCommandListener tello::Network::_commandListener{_commandConnection, networkInterface, _connectionMutex};
 UdpListener<tello::Network::invokeStatusListener> tello::Network::_statusListener{
         _statusConnection, networkInterface, tello::Tello::_telloMapping, tello::Tello::_telloMappingMutex,
         tello::Network::_connectionMutex, LoggerType::STATUS};
 
-UdpListener<tello::Network::invokeVideoListener> tello::Network::_videoListener {
-    _videoConnection, networkInterface, tello::Tello::_telloMapping, tello::Tello::_telloMappingMutex,
-        tello::Network::_connectionMutex, LoggerType::VIDEO};
+VideoListener<tello::Network::invokeVideoListener, tello::Network::updateVideoHealth,
+        tello::Network::acceptVideo> tello::Network::_videoListener {
+    _videoConnection, networkInterface, _videoAnalyzer, tello::Tello::_telloMapping, tello::Tello::_telloMappingMutex,
+        tello::Network::_connectionMutex};
 
 bool tello::Network::connect() {
     _connectionMutex.lock_shared();
@@ -83,6 +110,105 @@ void tello::Network::disconnect() {
     _connectionMutex.unlock();
 }
 
+void tello::Network::setDispatchThreads(int threads) {
+    _threadpool.resize(threads);
+}
+
+void tello::Network::setExecutor(shared_ptr<Executor> executor) {
+    std::atomic_store(&_executor, executor != nullptr ? std::move(executor) : _defaultExecutor);
+}
+
+shared_ptr<tello::Executor> tello::Network::executorOf(const Tello* tello) {
+    shared_ptr<Executor> executor = std::atomic_load(&tello->_executor);
+    return executor != nullptr ? executor : std::atomic_load(&_executor);
+}
+
+bool tello::Network::setRealtime(const RealtimeSettings& settings) {
+    shared_ptr<ThreadControlInterface> threadControl = ThreadControlFactory::build();
+    bool applied = schedule(*threadControl, _statusListener.worker(), settings._statusCpu, settings._priority,
+                            LoggerType::STATUS);
+    applied &= schedule(*threadControl, _commandListener.worker(), settings._commandCpu, settings._priority,
+                        LoggerType::COMMAND);
+    applied &= schedule(*threadControl, _videoListener.worker(), settings._videoCpu, settings._priority,
+                        LoggerType::VIDEO);
+
+    auto dispatchApplied = std::make_shared<std::atomic<bool>>(true);
+    _threadpool.setWorkerSetup([threadControl, settings, dispatchApplied](int worker, thread& thread) {
+        int cpu = settings._dispatchCpus.empty() ? REALTIME_ANY_CPU
+                                                 : settings._dispatchCpus[worker % settings._dispatchCpus.size()];
+        if (!schedule(*threadControl, thread, cpu, settings._priority, LoggerType::VIDEO)) {
+            *dispatchApplied = false;
+        }
+    });
+    applied &= *dispatchApplied;
+
+    size_t cachedFrames = GOP_CACHE_MAX_FRAMES;
+    size_t recordedFrames = VIDEO_RECORDER_QUEUE_CAPACITY;
+    if (settings._preallocatedFrames > 0) {
+        cachedFrames = std::min(settings._maxCachedFrames, (size_t) GOP_CACHE_MAX_FRAMES);
+        recordedFrames = std::min(settings._maxRecordedFrames, (size_t) VIDEO_RECORDER_QUEUE_CAPACITY);
+        // cache, queue, 2 reassembly buffers, recorder queue and the parameter sets kept by the recorder
+        size_t droneFrames = cachedFrames + VIDEO_QUEUE_CAPACITY + 2 + recordedFrames + 1;
+        if (settings._preallocatedFrames < droneFrames) {
+            LoggerInterface::warn(LoggerType::VIDEO, string("{0} preallocated frames do not cover a drone, "
+                                                             "cached, queued and recorded frames need {1}"),
+                                  std::to_string(settings._preallocatedFrames), std::to_string(droneFrames));
+        }
+        _framePool->preallocate(settings._preallocatedFrames);
+    }
+    _framePool->forbidAllocation(settings._preallocatedFrames > 0);
+    _gopCacheFrames = cachedFrames;
+    _recorderFrames = recordedFrames;
+    Tello::_telloMappingMutex.lock_shared();
+    for (auto& tello : Tello::_telloMapping) {
+        tello.second->_gopCache->limit(cachedFrames);
+        shared_ptr<VideoRecorder> videoRecorder = std::atomic_load(&tello.second->_videoRecorder);
+        if (videoRecorder != nullptr) {
+            videoRecorder->limit(recordedFrames);
+        }
+    }
+    Tello::_telloMappingMutex.unlock_shared();
+    if (settings._lockMemory && !threadControl->lockMemory()) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Memory not locked"), "");
+        applied = false;
+    }
+
+    _wakeupLatency.reset();
+    _threadpool.setWakeupLatency(settings._measureWakeup ? &_wakeupLatency : nullptr);
+    return applied;
+}
+
+const tello::LatencyHistogram& tello::Network::wakeupLatency() {
+    return _wakeupLatency;
+}
+
+size_t tello::Network::gopCacheFrames() {
+    return _gopCacheFrames;
+}
+
+size_t tello::Network::recorderFrames() {
+    return _recorderFrames;
+}
+
+bool tello::Network::schedule(ThreadControlInterface& threadControl, thread& thread, int cpu, int priority,
+                              const LoggerType& loggerType) {
+    if (!thread.joinable()) {
+        // joined by 'disconnect', the native handle is no longer valid
+        LoggerInterface::error(loggerType, string("Thread not running, not scheduled"), "");
+        return false;
+    }
+    bool applied = true;
+    if (cpu != REALTIME_ANY_CPU && !threadControl.pin(thread, cpu)) {
+        LoggerInterface::error(loggerType, string("Thread not pinned to CPU {}"), std::to_string(cpu));
+        applied = false;
+    }
+    if (priority > 0 && !threadControl.prioritize(thread, priority)) {
+        LoggerInterface::error(loggerType, string("Thread priority {} not set"), std::to_string(priority));
+        applied = false;
+    }
+    return applied;
+}
+
 optional<ConnectionData>
 tello::Network::connectToPort(unsigned short port, const ConnectionData& data, const LoggerType& loggerType) {
     if (data._fileDescriptor != -1) {
@@ -103,26 +229,118 @@ void tello::Network::disconnect(ConnectionData& connectionData, const LoggerType
     }
 }
 
-void tello::Network::invokeStatusListener(NetworkResponse& networkResponse, const tello::Tello* tello) {
-    if (tello->_statusHandler != nullptr) {
-        tello->_statusHandler(StatusResponse{networkResponse.response()});
+void tello::Network::invokeStatusListener(const NetworkData& sender, char* data, int length, const tello::Tello* tello) {
+    StatusSample sample;
+    if (!StatusSample::parse(data, length, sample)) {
+        return;
+    }
+
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    int64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+
+    // the setters may replace the sinks while the drone is flying, the copies keep them alive for this sample
+    shared_ptr<TelemetryRecorder> telemetryRecorder = std::atomic_load(&tello->_telemetryRecorder);
+    if (telemetryRecorder != nullptr) {
+        telemetryRecorder->record(sender._ip, timestamp, sample);
+    }
+    shared_ptr<TelemetryTable> telemetryTable = std::atomic_load(&tello->_telemetryTable);
+    if (telemetryTable != nullptr) {
+        telemetryTable->update(sender._ip, timestamp, sample);
+    }
+
+    // the filters run here on the decoded sample, rejected samples never take a place in the bounded queue
+    uint64_t accepted = 0;
+    bool unslotted = false;
+    tello->_statusSubscribers->forEachSlot([&](size_t slot, StatusSubscriber& subscriber) {
+        if (slot == SUBSCRIBER_NO_SLOT) {
+            unslotted = true;
+        } else if (subscriber._filter.accept(sample, timestamp)) {
+            accepted |= 1ULL << slot;
+        }
+    });
+    if ((accepted == 0 && !unslotted) || !tello->_statusQueue->push(sample, timestamp, accepted)) {
+        return;
+    }
+
+    // like the video, one drain per drone delivers the updates in order, a slow handler never blocks the socket
+    executorOf(tello)->post([subscribers = tello->_statusSubscribers, queue = tello->_statusQueue](int) {
+        for (optional<QueuedStatus> next = queue->pop(); next; next = queue->pop()) {
+            // built for the first delivery only, a sample whose subscribers are gone costs no response
+            optional<StatusResponse> response;
+            subscribers->forEachSlot([&next, &response](size_t slot, StatusSubscriber& subscriber) {
+                // subscribers beyond the slots are filtered here
+                bool deliver = slot == SUBSCRIBER_NO_SLOT ? subscriber._filter.accept(next->_sample, next->_timestamp)
+                                                          : (next->_accepted & (1ULL << slot)) != 0;
+                if (!deliver) {
+                    return;
+                }
+                if (!response) {
+                    response.emplace(next->_sample);
+                }
+                subscriber._handler(*response);
+            });
+        }
+    });
+}
+
+void tello::Network::invokeVideoListener(FrameHandle&& frame, const Tello* tello) {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    tello->_videoHealth->frame(frame.length(), frame.info()._keyframe, frame.info()._receiveTime,
+                               std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+    tello->_gopCache->push(frame);
+    shared_ptr<VideoRecorder> videoRecorder = std::atomic_load(&tello->_videoRecorder);
+    shared_ptr<VideoRingPublisher> videoRing = std::atomic_load(&tello->_videoRing);
+    if (videoRecorder != nullptr || videoRing != nullptr) {
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        int64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+        if (videoRecorder != nullptr) {
+            videoRecorder->record(tello->_clientaddr._ip, frame, timestamp);
+        }
+        if (videoRing != nullptr) {
+            videoRing->publish(tello->_clientaddr._ip, frame, timestamp);
+        }
+    }
+    if (tello->_videoSubscribers->empty() || !tello->_videoQueue->push(std::move(frame))) {
+        return;
     }
+
+    // one drain per drone on any executor: one task at a time, frames in order
+    executorOf(tello)->post([subscribers = tello->_videoSubscribers, queue = tello->_videoQueue](int) {
+        for (FrameHandle next = queue->pop(); next; next = queue->pop()) {
+            VideoResponse videoResponse{next};
+            subscribers->forEach([&videoResponse](const video_handler& handler) {
+                handler(videoResponse);
+            });
+        }
+    });
 }
 
-void tello::Network::invokeVideoListener(NetworkResponse& response, const Tello* tello) {
-    ip_address ip = response._sender._ip;
-    bool frameFull = _videoAnalyzer.append(response);
-    if (frameFull) {
-        unsigned char* frame = _videoAnalyzer.frame(ip);
-        unsigned int length = _videoAnalyzer.length(ip);
-        _videoAnalyzer.clean(ip);
+void tello::Network::updateVideoHealth(const VideoStatistics& statistics, const Tello* tello) {
+    tello->_videoHealth->reassembly(statistics);
+}
 
-        _threadpool.push([tello, frame, length](int id) {
-            if (tello->_videoHandler != nullptr) {
-                VideoResponse videoResponse{frame, length};
-                tello->_videoHandler(videoResponse);
-            }
-            delete[] frame;
-        });
+bool tello::Network::acceptVideo(const Tello* tello) {
+    return tello->_videoDemand->wanted();
+}
+
+void tello::Network::NalUnitDispatcher::nalUnit(ip_address address, const unsigned char* data, size_t length,
+                                                bool lastInFrame, int64_t receiveTime) {
+    // the video listener holds the shared lock of the mapping
+    auto telloIt = Tello::_telloMapping.find(address);
+    if (telloIt != Tello::_telloMapping.end()) {
+        invokeNalUnitListener(NalUnitResponse{data, length, lastInFrame, receiveTime}, telloIt->second);
     }
+}
+
+void tello::Network::invokeNalUnitListener(const NalUnitResponse& nalUnit, const Tello* tello) {
+    if (tello->_nalUnitSubscribers->empty()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    tello->_nalUnitLatency->record(
+            std::chrono::duration_cast<std::chrono::microseconds>(now).count() - nalUnit.receiveTime());
+    tello->_nalUnitSubscribers->forEach([&nalUnit](const nal_unit_handler& handler) {
+        handler(nalUnit);
+    });
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <optional>
 #include "udp_listener.hpp"
+#include "video_listener.hpp"
 #include "tello/response/status_response.hpp"
 #include <memory>
 #include "tello/native/network_interface.hpp"
@@ -11,11 +13,15 @@
 #include "udp_command_listener.hpp"
 #include "../thread/thread_pool.hpp"
 #include <tello/tello.hpp>
+#include <tello/connection/realtime_settings.hpp>
+#include <tello/latency_histogram.hpp>
+#include <tello/executor.hpp>
 #include <vector>
 
 using tello::ConnectionData;
 using std::optional;
 using tello::UdpListener;
+using tello::VideoListener;
 using tello::StatusResponse;
 using std::shared_ptr;
 using std::unique_ptr;
@@ -29,6 +35,8 @@ using tello::threading::Threadpool;
 
 namespace tello {
 
+    class ThreadControlInterface;
+
     class Network {
     public:
         Network() = delete;
@@ -37,6 +45,18 @@ namespace tello {
 
         static bool connect();
         static void disconnect();
+        static void setDispatchThreads(int threads);
+        static void setExecutor(shared_ptr<Executor> executor);
+        static bool setRealtime(const RealtimeSettings& settings);
+        static const LatencyHistogram& wakeupLatency();
+        /**
+         * Limit of the GOP cache of every drone
+         */
+        static size_t gopCacheFrames();
+        /**
+         * Limit of the frames held by a video recorder
+         */
+        static size_t recorderFrames();
 
         template<typename CommandResponse>
         static future<CommandResponse>
@@ -47,24 +67,43 @@ namespace tello {
         exec(const Command& command, unordered_map<ip_address, const Tello*> tellos);
 
     private:
+        class NalUnitDispatcher : public NalUnitSink {
+        public:
+            void nalUnit(ip_address address, const unsigned char* data, size_t length, bool lastInFrame,
+                         int64_t receiveTime) override;
+        };
+
         static ConnectionData _commandConnection;
         static ConnectionData _statusConnection;
         static ConnectionData _videoConnection;
         static std::shared_mutex _connectionMutex;
         static shared_ptr<NetworkInterface> networkInterface;
+        static NalUnitDispatcher _nalUnitDispatcher;
+        static shared_ptr<video::FramePool> _framePool;
         static VideoAnalyzer _videoAnalyzer;
         static UdpCommandListener _commandListener;
         static Threadpool _threadpool;
-
-        static void invokeStatusListener(NetworkResponse& response, const Tello* tello);
-        static void invokeVideoListener(NetworkResponse& response, const Tello* tello);
+        static LatencyHistogram _wakeupLatency;
+        static std::atomic<size_t> _gopCacheFrames;
+        static std::atomic<size_t> _recorderFrames;
+        static shared_ptr<Executor> _defaultExecutor;
+        static shared_ptr<Executor> _executor;
+
+        static void invokeStatusListener(const NetworkData& sender, char* data, int length, const Tello* tello);
+        static void invokeVideoListener(FrameHandle&& frame, const Tello* tello);
+        static void updateVideoHealth(const VideoStatistics& statistics, const Tello* tello);
+        static bool acceptVideo(const Tello* tello);
+        static void invokeNalUnitListener(const NalUnitResponse& nalUnit, const Tello* tello);
 
         static UdpListener<invokeStatusListener> _statusListener;
-        static UdpListener<invokeVideoListener> _videoListener;
+        static VideoListener<invokeVideoListener, updateVideoHealth, acceptVideo> _videoListener;
 
         static optional<ConnectionData>
         connectToPort(unsigned short port, const ConnectionData& connectionData, const LoggerType& loggerType);
         static void disconnect(ConnectionData& connectionData, const LoggerType& loggerType);
+        static shared_ptr<Executor> executorOf(const Tello* tello);
+        static bool schedule(ThreadControlInterface& threadControl, thread& thread, int cpu, int priority,
+                             const LoggerType& loggerType);
     };
 
     template<typename CommandResponse>
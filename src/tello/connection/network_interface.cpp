@@ -7,4 +7,20 @@ bool tello::TelloNetwork::connect() {
 
 void tello::TelloNetwork::disconnect() {
     Network::disconnect();
+}
+
+void tello::TelloNetwork::setDispatchThreads(int threads) {
+    Network::setDispatchThreads(threads);
+}
+
+void tello::TelloNetwork::setExecutor(std::shared_ptr<Executor> executor) {
+    Network::setExecutor(std::move(executor));
+}
+
+bool tello::TelloNetwork::setRealtime(const RealtimeSettings& settings) {
+    return Network::setRealtime(settings);
+}
+
+const tello::LatencyHistogram& tello::TelloNetwork::wakeupLatency() {
+    return Network::wakeupLatency();
 }
\ No newline at end of file
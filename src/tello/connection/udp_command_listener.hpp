@@ -62,6 +62,10 @@ namespace tello {
 
         void stop();
 
+        [[nodiscard]] thread& worker() {
+            return _worker;
+        }
+
         template <typename Response>
         unordered_map<ip_address, future<Response>> append(vector<ip_address>& responses) {
             _responseMutex.lock();
@@ -10,6 +10,8 @@
 #include <shared_mutex>
 #include <memory>
 
+#define UDP_LISTENER_BUFFER_LENGTH 2048
+
 using ip_address = unsigned long;
 using std::unordered_map;
 using std::thread;
@@ -23,7 +25,11 @@ namespace tello {
 
     class Tello;
 
-    template<void (* invoke)(NetworkResponse&, const Tello* tello)>
+    /**
+     * Receives datagrams into a buffer owned by the listener thread.
+     * 'invoke' gets a view of the datagram, it is only valid during the call.
+     */
+    template<void (* invoke)(const NetworkData& sender, char* data, int length, const Tello* tello)>
     class UdpListener {
     public:
         UdpListener(const ConnectionData& connectionData, shared_ptr<NetworkInterface> networkInterface,
@@ -40,6 +46,10 @@ namespace tello {
             _worker.join();
         }
 
+        [[nodiscard]] thread& worker() {
+            return _worker;
+        }
+
     private:
         promise<void> _exitSignal;
         thread _worker;
@@ -49,6 +59,8 @@ namespace tello {
                            std::shared_mutex& connectionMutex, future<void> exitListener,
                            LoggerType loggerType) {
             bool isFirstAccessToFileDescriptor = true;
+            char buffer[UDP_LISTENER_BUFFER_LENGTH];
+            NetworkData sender{};
 
             while (exitListener.wait_for(std::chrono::nanoseconds(100)) == std::future_status::timeout) {
                 connectionMutex.lock_shared();
@@ -61,17 +73,23 @@ namespace tello {
                     isFirstAccessToFileDescriptor = false;
                 }
 
-                NetworkResponse networkResponse = networkInterface->read(connectionData._fileDescriptor);
+                int length = networkInterface->read(connectionData._fileDescriptor, buffer,
+                                                    UDP_LISTENER_BUFFER_LENGTH - 1, sender);
                 connectionMutex.unlock_shared();
 
+                if (length <= 0) {
+                    continue;
+                }
+                buffer[length] = '\0';
+
                 telloMappingMutex.lock_shared();
 
-                auto telloIt = telloMapping.find(networkResponse._sender._ip);
+                auto telloIt = telloMapping.find(sender._ip);
                 if (telloIt != telloMapping.end()) {
-                    invoke(networkResponse, telloIt->second);
-                } else if (networkResponse._length > 0) {
+                    invoke(sender, buffer, length, telloIt->second);
+                } else {
                     LoggerInterface::warn(loggerType, string("Received data {0} from unknown Tello {1}"),
-                                                           networkResponse.response(), std::to_string(networkResponse._sender._ip));
+                                                           string(buffer, length), std::to_string(sender._ip));
                 }
                 telloMappingMutex.unlock_shared();
             }
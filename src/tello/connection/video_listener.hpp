@@ -0,0 +1,118 @@
+#pragma once
+
+#include <unordered_map>
+#include <thread>
+#include <future>
+#include <string>
+#include "tello/logger/logger_interface.hpp"
+#include "tello/native/network_interface.hpp"
+#include "tello/video_analyzer.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <chrono>
+
+using ip_address = unsigned long;
+using std::unordered_map;
+using std::thread;
+using std::promise;
+using std::future;
+using tello::LoggerInterface;
+using tello::LoggerType;
+using std::shared_ptr;
+
+namespace tello {
+
+    class Tello;
+
+    /**
+     * Receives video packets directly into the reassembly buffer of the drone, which sent the last packet.
+     * Only if another drone sent the packet, it is copied once into the frame of that drone.
+     * 'invoke' gets every complete frame, 'update' the reassembly counters of the drone after every packet.
+     * Packets of a drone nobody 'accept's are discarded before reassembly.
+     */
+    template<void (* invoke)(FrameHandle&& frame, const Tello* tello),
+            void (* update)(const VideoStatistics& statistics, const Tello* tello),
+            bool (* accept)(const Tello* tello)>
+    class VideoListener {
+    public:
+        VideoListener(const ConnectionData& connectionData, shared_ptr<NetworkInterface> networkInterface,
+                      VideoAnalyzer& videoAnalyzer, unordered_map<ip_address, const Tello*>& telloMapping,
+                      std::shared_mutex& telloMappingMutex, std::shared_mutex& connectionMutex)
+                : _exitSignal(),
+                  _worker(thread(&VideoListener::listen, std::ref(connectionData), networkInterface,
+                                 std::ref(videoAnalyzer), std::ref(telloMapping), std::ref(telloMappingMutex),
+                                 std::ref(connectionMutex), _exitSignal.get_future())) {
+        }
+
+        void stop() {
+            _exitSignal.set_value();
+            _worker.join();
+        }
+
+        [[nodiscard]] thread& worker() {
+            return _worker;
+        }
+
+    private:
+        promise<void> _exitSignal;
+        thread _worker;
+
+        static void listen(const tello::ConnectionData& connectionData, shared_ptr<NetworkInterface> networkInterface,
+                           VideoAnalyzer& videoAnalyzer, unordered_map<ip_address, const Tello*>& telloMapping,
+                           std::shared_mutex& telloMappingMutex, std::shared_mutex& connectionMutex,
+                           future<void> exitListener) {
+            bool isFirstAccessToFileDescriptor = true;
+            ip_address expected = 0;
+            NetworkData sender{};
+
+            while (exitListener.wait_for(std::chrono::nanoseconds(100)) == std::future_status::timeout) {
+                connectionMutex.lock_shared();
+                if (connectionData._fileDescriptor == -1) {
+                    connectionMutex.unlock_shared();
+                    continue;
+                } else if (isFirstAccessToFileDescriptor) {
+                    LoggerInterface::info(LoggerType::VIDEO, string("Start listen to port {}"),
+                                          std::to_string(connectionData._networkData._port));
+                    isFirstAccessToFileDescriptor = false;
+                }
+
+                size_t available = 0;
+                unsigned char* buffer = videoAnalyzer.receiveBuffer(expected, available);
+                int length = networkInterface->read(connectionData._fileDescriptor, reinterpret_cast<char*>(buffer),
+                                                    static_cast<int>(available), sender);
+                connectionMutex.unlock_shared();
+
+                if (length <= 0) {
+                    continue;
+                }
+
+                telloMappingMutex.lock_shared();
+
+                auto telloIt = telloMapping.find(sender._ip);
+                if (telloIt != telloMapping.end() && !accept(telloIt->second)) {
+                    videoAnalyzer.clean(sender._ip);
+                    expected = sender._ip;
+                } else if (telloIt != telloMapping.end()) {
+                    auto now = std::chrono::steady_clock::now().time_since_epoch();
+                    int64_t receiveTime = std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+                    if (videoAnalyzer.commit(expected, sender._ip, length, receiveTime)) {
+                        for (FrameHandle frame = videoAnalyzer.take(sender._ip); frame;
+                             frame = videoAnalyzer.take(sender._ip)) {
+                            invoke(std::move(frame), telloIt->second);
+                        }
+                    }
+                    update(videoAnalyzer.statistics(sender._ip), telloIt->second);
+                    expected = sender._ip;
+                } else {
+                    LoggerInterface::warn(LoggerType::VIDEO, string("Received {0} video bytes from unknown Tello {1}"),
+                                          std::to_string(length), std::to_string(sender._ip));
+                }
+                telloMappingMutex.unlock_shared();
+            }
+
+            LoggerInterface::info(LoggerType::VIDEO, string("Stop listen to port {0}"),
+                                  std::to_string(connectionData._networkData._port));
+        }
+    };
+}
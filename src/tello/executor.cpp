@@ -0,0 +1,5 @@
+#include <tello/executor.hpp>
+
+void tello::InlineExecutor::post(executor_task&& task) {
+    task(0);
+}
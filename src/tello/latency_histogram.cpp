@@ -0,0 +1,67 @@
+#include <tello/latency_histogram.hpp>
+
+tello::LatencyHistogram::LatencyHistogram() : _buckets(), _count(0), _sum(0), _max(0) {
+    reset();
+}
+
+void tello::LatencyHistogram::record(int64_t latency) {
+    if (latency < 0) {
+        latency = 0;
+    }
+
+    int index = 0;
+    while (index < LATENCY_BUCKETS - 1 && (int64_t(1) << index) <= latency) {
+        index++;
+    }
+
+    _buckets[index].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+
+    int64_t max = _max.load(std::memory_order_relaxed);
+    while (latency > max && !_max.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+    }
+}
+
+void tello::LatencyHistogram::reset() {
+    for (auto& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _count.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t tello::LatencyHistogram::count() const {
+    return _count.load(std::memory_order_relaxed);
+}
+
+uint64_t tello::LatencyHistogram::bucket(int index) const {
+    return index >= 0 && index < LATENCY_BUCKETS ? _buckets[index].load(std::memory_order_relaxed) : 0;
+}
+
+int64_t tello::LatencyHistogram::max() const {
+    return _max.load(std::memory_order_relaxed);
+}
+
+double tello::LatencyHistogram::mean() const {
+    uint64_t count = this->count();
+    return count > 0 ? static_cast<double>(_sum.load(std::memory_order_relaxed)) / count : 0.0;
+}
+
+int64_t tello::LatencyHistogram::percentile(double percentile) const {
+    uint64_t count = this->count();
+    if (count == 0) {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(percentile / 100.0 * count);
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += bucket(i);
+        if (seen > rank || seen == count) {
+            return int64_t(1) << i;
+        }
+    }
+    return max();
+}
@@ -0,0 +1,18 @@
+#include "address_wait_factory.hpp"
+#include "address_wait_interface.hpp"
+
+using tello::AddressWaitInterface;
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32)
+    #include "windows/address_wait_impl.hpp"
+
+    using tello::windows::AddressWaitImpl;
+#else
+    #include "posix/address_wait_impl.hpp"
+
+    using tello::posix::AddressWaitImpl;
+#endif
+
+unique_ptr<AddressWaitInterface> tello::AddressWaitFactory::build() {
+    return std::make_unique<AddressWaitImpl>();
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <memory>
+
+using std::unique_ptr;
+
+namespace tello {
+
+    class AddressWaitInterface;
+
+    class AddressWaitFactory {
+    public:
+        static unique_ptr<AddressWaitInterface> build();
+
+    private:
+        AddressWaitFactory() = default;
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace tello {
+
+    /**
+     * Platform independent sleeping on a 32 bit word, which may lie in memory shared between processes.
+     */
+    class AddressWaitInterface {
+    public:
+        virtual ~AddressWaitInterface() = default;
+
+        /**
+         * false, if the platform cannot wait on shared memory, callers poll instead
+         */
+        [[nodiscard]] virtual bool supported() const = 0;
+
+        /**
+         * Sleeps while 'word' holds 'expected', at most 'timeout' microseconds. May return early.
+         */
+        virtual void wait(const std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout) = 0;
+
+        /**
+         * Wakes every thread waiting on 'word', in any process
+         */
+        virtual void wake(std::atomic<uint32_t>& word) = 0;
+    };
+}
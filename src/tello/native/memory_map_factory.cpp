@@ -0,0 +1,18 @@
+#include "memory_map_factory.hpp"
+#include "memory_map_interface.hpp"
+
+using tello::MemoryMapInterface;
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32)
+    #include "windows/memory_map_impl.hpp"
+
+    using tello::windows::MemoryMapImpl;
+#else
+    #include "posix/memory_map_impl.hpp"
+
+    using tello::posix::MemoryMapImpl;
+#endif
+
+unique_ptr<MemoryMapInterface> tello::MemoryMapFactory::build() {
+    return std::make_unique<MemoryMapImpl>();
+}
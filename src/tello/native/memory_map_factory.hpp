@@ -0,0 +1,18 @@
+#pragma once
+
+#include <memory>
+
+using std::unique_ptr;
+
+namespace tello {
+
+    class MemoryMapInterface;
+
+    class MemoryMapFactory {
+    public:
+        static unique_ptr<MemoryMapInterface> build();
+
+    private:
+        MemoryMapFactory() = default;
+    };
+}
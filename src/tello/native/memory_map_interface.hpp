@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+using std::string;
+
+namespace tello {
+
+    /**
+     * Platform independent file backed memory mapping.
+     */
+    class MemoryMapInterface {
+    public:
+        virtual ~MemoryMapInterface() = default;
+
+        /**
+         * Maps a file. A writable mapping creates the file if necessary and grows it to 'size'.
+         * Size 0 maps the whole existing file and fails for a missing or empty file.
+         */
+        virtual bool open(const string& path, size_t size, bool writable) = 0;
+        virtual bool resize(size_t size) = 0;
+        virtual bool flush() = 0;
+        virtual void close() = 0;
+
+        [[nodiscard]] virtual char* data() const = 0;
+        [[nodiscard]] virtual size_t size() const = 0;
+    };
+}
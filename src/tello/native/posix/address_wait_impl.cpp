@@ -0,0 +1,35 @@
+#include "address_wait_impl.hpp"
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "the futex word is the atomic itself");
+#endif
+
+bool tello::posix::AddressWaitImpl::supported() const {
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void tello::posix::AddressWaitImpl::wait(const std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout) {
+#if defined(__linux__)
+    timespec relative{};
+    relative.tv_sec = static_cast<time_t>(timeout / 1000000);
+    relative.tv_nsec = static_cast<long>((timeout % 1000000) * 1000);
+    // no FUTEX_PRIVATE_FLAG, the word is shared with other processes (read-only mappings are fine for waiting)
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), FUTEX_WAIT, expected, &relative, nullptr, 0);
+#endif
+}
+
+void tello::posix::AddressWaitImpl::wake(std::atomic<uint32_t>& word) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
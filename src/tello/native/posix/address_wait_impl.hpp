@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../address_wait_interface.hpp"
+
+namespace tello::posix {
+
+    /**
+     * Futex on Linux, other POSIX systems have no waiting on shared memory
+     */
+    class AddressWaitImpl : public AddressWaitInterface {
+    public:
+        [[nodiscard]] bool supported() const override;
+        void wait(const std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout) override;
+        void wake(std::atomic<uint32_t>& word) override;
+    };
+}
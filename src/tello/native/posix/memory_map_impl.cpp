@@ -0,0 +1,92 @@
+#include "memory_map_impl.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+tello::posix::MemoryMapImpl::MemoryMapImpl() : _fileDescriptor(-1), _data(nullptr), _size(0), _writable(false) {}
+
+tello::posix::MemoryMapImpl::~MemoryMapImpl() {
+    close();
+}
+
+bool tello::posix::MemoryMapImpl::open(const string& path, size_t size, bool writable) {
+    close();
+    _writable = writable;
+    _fileDescriptor = ::open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if (_fileDescriptor < 0) {
+        return false;
+    }
+
+    if (size == 0) {
+        struct stat fileStat{};
+        if (fstat(_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+            close();
+            return false;
+        }
+        size = static_cast<size_t>(fileStat.st_size);
+    }
+
+    if (!map(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool tello::posix::MemoryMapImpl::resize(size_t size) {
+    if (!_writable || _fileDescriptor < 0) {
+        return false;
+    }
+    unmap();
+    return map(size);
+}
+
+bool tello::posix::MemoryMapImpl::flush() {
+    return _data == nullptr || msync(_data, _size, MS_ASYNC) == 0;
+}
+
+void tello::posix::MemoryMapImpl::close() {
+    unmap();
+    if (_fileDescriptor >= 0) {
+        ::close(_fileDescriptor);
+        _fileDescriptor = -1;
+    }
+}
+
+char* tello::posix::MemoryMapImpl::data() const {
+    return _data;
+}
+
+size_t tello::posix::MemoryMapImpl::size() const {
+    return _size;
+}
+
+bool tello::posix::MemoryMapImpl::map(size_t size) {
+    if (_writable) {
+        struct stat fileStat{};
+        if (fstat(_fileDescriptor, &fileStat) != 0) {
+            return false;
+        }
+        if (static_cast<size_t>(fileStat.st_size) < size && ftruncate(_fileDescriptor, size) != 0) {
+            return false;
+        }
+    }
+
+    void* data = mmap(nullptr, size, _writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, _fileDescriptor, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    _data = static_cast<char*>(data);
+    _size = size;
+    return true;
+}
+
+void tello::posix::MemoryMapImpl::unmap() {
+    if (_data != nullptr) {
+        munmap(_data, _size);
+        _data = nullptr;
+    }
+    _size = 0;
+}
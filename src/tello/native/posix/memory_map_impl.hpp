@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../memory_map_interface.hpp"
+
+namespace tello::posix {
+
+    class MemoryMapImpl : public MemoryMapInterface {
+    public:
+        MemoryMapImpl();
+        ~MemoryMapImpl() override;
+
+        bool open(const string& path, size_t size, bool writable) override;
+        bool resize(size_t size) override;
+        bool flush() override;
+        void close() override;
+
+        [[nodiscard]] char* data() const override;
+        [[nodiscard]] size_t size() const override;
+
+    private:
+        int _fileDescriptor;
+        char* _data;
+        size_t _size;
+        bool _writable;
+
+        bool map(size_t size);
+        void unmap();
+    };
+}
@@ -0,0 +1,29 @@
+#include "thread_control_impl.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+bool tello::posix::ThreadControlImpl::pin(std::thread& thread, int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus) == 0;
+#else
+    // e.g. macOS only knows affinity hints
+    return false;
+#endif
+}
+
+bool tello::posix::ThreadControlImpl::prioritize(std::thread& thread, int priority) {
+    sched_param parameter{};
+    parameter.sched_priority = priority;
+    return pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &parameter) == 0;
+}
+
+bool tello::posix::ThreadControlImpl::lockMemory() {
+    return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+}
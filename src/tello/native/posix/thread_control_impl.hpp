@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../thread_control_interface.hpp"
+
+namespace tello::posix {
+
+    class ThreadControlImpl : public ThreadControlInterface {
+    public:
+        bool pin(std::thread& thread, int cpu) override;
+        bool prioritize(std::thread& thread, int priority) override;
+        bool lockMemory() override;
+    };
+}
@@ -0,0 +1,18 @@
+#include "thread_control_factory.hpp"
+#include "thread_control_interface.hpp"
+
+using tello::ThreadControlInterface;
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32)
+    #include "windows/thread_control_impl.hpp"
+
+    using tello::windows::ThreadControlImpl;
+#else
+    #include "posix/thread_control_impl.hpp"
+
+    using tello::posix::ThreadControlImpl;
+#endif
+
+unique_ptr<ThreadControlInterface> tello::ThreadControlFactory::build() {
+    return std::make_unique<ThreadControlImpl>();
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <memory>
+
+using std::unique_ptr;
+
+namespace tello {
+
+    class ThreadControlInterface;
+
+    class ThreadControlFactory {
+    public:
+        static unique_ptr<ThreadControlInterface> build();
+
+    private:
+        ThreadControlFactory() = default;
+    };
+}
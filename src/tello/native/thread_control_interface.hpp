@@ -0,0 +1,29 @@
+#pragma once
+
+#include <thread>
+
+namespace tello {
+
+    /**
+     * Platform independent scheduling of threads for the real-time mode.
+     */
+    class ThreadControlInterface {
+    public:
+        virtual ~ThreadControlInterface() = default;
+
+        /**
+         * Restricts the thread to one CPU
+         */
+        virtual bool pin(std::thread& thread, int cpu) = 0;
+
+        /**
+         * Runs the thread with a fixed real-time priority (1 - 99, SCHED_FIFO where available)
+         */
+        virtual bool prioritize(std::thread& thread, int priority) = 0;
+
+        /**
+         * Keeps all current and future pages of the process in memory
+         */
+        virtual bool lockMemory() = 0;
+    };
+}
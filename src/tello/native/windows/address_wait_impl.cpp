@@ -0,0 +1,11 @@
+#include "address_wait_impl.hpp"
+
+bool tello::windows::AddressWaitImpl::supported() const {
+    return false;
+}
+
+void tello::windows::AddressWaitImpl::wait(const std::atomic<uint32_t>&, uint32_t, int64_t) {
+}
+
+void tello::windows::AddressWaitImpl::wake(std::atomic<uint32_t>&) {
+}
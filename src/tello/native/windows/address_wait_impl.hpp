@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../address_wait_interface.hpp"
+
+namespace tello::windows {
+
+    /**
+     * WaitOnAddress only works inside one process, readers of shared memory poll
+     */
+    class AddressWaitImpl : public AddressWaitInterface {
+    public:
+        [[nodiscard]] bool supported() const override;
+        void wait(const std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout) override;
+        void wake(std::atomic<uint32_t>& word) override;
+    };
+}
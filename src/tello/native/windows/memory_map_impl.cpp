@@ -0,0 +1,98 @@
+#include "memory_map_impl.hpp"
+
+tello::windows::MemoryMapImpl::MemoryMapImpl() : _file(INVALID_HANDLE_VALUE), _mapping(nullptr), _data(nullptr),
+                                                 _size(0), _writable(false) {}
+
+tello::windows::MemoryMapImpl::~MemoryMapImpl() {
+    close();
+}
+
+bool tello::windows::MemoryMapImpl::open(const string& path, size_t size, bool writable) {
+    close();
+    _writable = writable;
+    _file = CreateFileA(path.c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    if (size == 0) {
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0) {
+            close();
+            return false;
+        }
+        size = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    if (!map(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool tello::windows::MemoryMapImpl::resize(size_t size) {
+    if (!_writable || _file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    unmap();
+    // A mapping object of a larger size extends the underlying file.
+    return map(size);
+}
+
+bool tello::windows::MemoryMapImpl::flush() {
+    return _data == nullptr || FlushViewOfFile(_data, 0) != 0;
+}
+
+void tello::windows::MemoryMapImpl::close() {
+    unmap();
+    if (_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+    }
+}
+
+char* tello::windows::MemoryMapImpl::data() const {
+    return _data;
+}
+
+size_t tello::windows::MemoryMapImpl::size() const {
+    return _size;
+}
+
+bool tello::windows::MemoryMapImpl::map(size_t size) {
+    auto fileSize = static_cast<unsigned long long>(size);
+    _mapping = CreateFileMappingA(_file, nullptr, _writable ? PAGE_READWRITE : PAGE_READONLY,
+                                  static_cast<DWORD>(fileSize >> 32), static_cast<DWORD>(fileSize & 0xFFFFFFFF),
+                                  nullptr);
+    if (_mapping == nullptr) {
+        return false;
+    }
+
+    _data = static_cast<char*>(MapViewOfFile(_mapping, _writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size));
+    if (_data == nullptr) {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+        return false;
+    }
+
+    _size = size;
+    return true;
+}
+
+void tello::windows::MemoryMapImpl::unmap() {
+    if (_data != nullptr) {
+        if (_writable) {
+            FlushViewOfFile(_data, 0);
+        }
+        UnmapViewOfFile(_data);
+        _data = nullptr;
+    }
+    if (_mapping != nullptr) {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+    _size = 0;
+}
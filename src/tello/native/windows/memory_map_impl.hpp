@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include "../memory_map_interface.hpp"
+
+namespace tello::windows {
+
+    class MemoryMapImpl : public MemoryMapInterface {
+    public:
+        MemoryMapImpl();
+        ~MemoryMapImpl() override;
+
+        bool open(const string& path, size_t size, bool writable) override;
+        bool resize(size_t size) override;
+        bool flush() override;
+        void close() override;
+
+        [[nodiscard]] char* data() const override;
+        [[nodiscard]] size_t size() const override;
+
+    private:
+        HANDLE _file;
+        HANDLE _mapping;
+        char* _data;
+        size_t _size;
+        bool _writable;
+
+        bool map(size_t size);
+        void unmap();
+    };
+}
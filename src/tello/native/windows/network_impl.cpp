@@ -93,6 +93,30 @@ tello::windows::NetworkImpl::send(const int& fileDescriptor, const NetworkData&
     return 0;
 }
 
+int tello::windows::NetworkImpl::send(const int& fileDescriptor, const NetworkData& receiver,
+                                      const SendBuffer* buffers, int count) const {
+    if (count <= 0 || count > SEND_MAX_BUFFERS) {
+        return SEND_ERROR_CODE;
+    }
+
+    WSABUF gather[SEND_MAX_BUFFERS];
+    for (int i = 0; i < count; i++) {
+        gather[i].buf = const_cast<char*>(buffers[i]._data);
+        gather[i].len = static_cast<ULONG>(buffers[i]._length);
+    }
+
+    sockaddr_in target = map(receiver);
+    DWORD sent = 0;
+    int sendResult = WSASendTo(fileDescriptor, gather, count, &sent, 0, (const sockaddr*) &target, sizeof(target),
+                               nullptr, nullptr);
+
+    if (sendResult == SOCKET_ERROR) {
+        return SEND_ERROR_CODE;
+    }
+
+    return 0;
+}
+
 NetworkResponse tello::windows::NetworkImpl::read(const int& fileDescriptor) const {
     char* buffer = new char[BUFFER_LENGTH];
     int n = 0;
@@ -109,6 +133,18 @@ NetworkResponse tello::windows::NetworkImpl::read(const int& fileDescriptor) con
                            buffer, n);
 }
 
+int tello::windows::NetworkImpl::read(const int& fileDescriptor, char* buffer, int length,
+                                      NetworkData& sender) const {
+    sockaddr_in senderAddr{};
+    memset(&senderAddr, 0, sizeof(senderAddr));
+    int senderAddrSize = sizeof(senderAddr);
+
+    int n = recvfrom(fileDescriptor, buffer, length, 0, (struct sockaddr*) &senderAddr, &senderAddrSize);
+
+    sender = NetworkData{SIN_FAM::I_AF_INET, ntohs(senderAddr.sin_port), ntohl(senderAddr.sin_addr.s_addr)};
+    return n >= 0 ? n : 0;
+}
+
 sockaddr_in tello::windows::NetworkImpl::map(const NetworkData& source) const {
     sockaddr_in sockAddr{};
     memset(&sockAddr, 0, sizeof(sockAddr));
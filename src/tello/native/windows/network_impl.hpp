@@ -16,6 +16,10 @@ namespace tello::windows {
         [[nodiscard]] int
         send(const int& fileDescriptor, const NetworkData& receiver, const string& value) const override;
         [[nodiscard]] NetworkResponse read(const int& fileDescriptor) const override;
+        [[nodiscard]] int send(const int& fileDescriptor, const NetworkData& receiver, const SendBuffer* buffers,
+                               int count) const override;
+        [[nodiscard]] int
+        read(const int& fileDescriptor, char* buffer, int length, NetworkData& sender) const override;
 
     private:
         WSAData _wsaData;
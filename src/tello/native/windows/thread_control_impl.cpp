@@ -0,0 +1,26 @@
+#include "thread_control_impl.hpp"
+
+bool tello::windows::ThreadControlImpl::pin(std::thread& thread, int cpu) {
+    if (cpu < 0 || cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+        return false;
+    }
+    auto handle = static_cast<HANDLE>(thread.native_handle());
+    return SetThreadAffinityMask(handle, static_cast<DWORD_PTR>(1) << cpu) != 0;
+}
+
+bool tello::windows::ThreadControlImpl::prioritize(std::thread& thread, int priority) {
+    // Windows has no priority levels inside the real-time class of a normal process
+    auto handle = static_cast<HANDLE>(thread.native_handle());
+    return priority > 0 && SetThreadPriority(handle, THREAD_PRIORITY_TIME_CRITICAL) != 0;
+}
+
+bool tello::windows::ThreadControlImpl::lockMemory() {
+    // no equivalent of mlockall, a large minimal working set keeps the preallocated buffers resident
+    SIZE_T minimum = 0;
+    SIZE_T maximum = 0;
+    HANDLE process = GetCurrentProcess();
+    if (!GetProcessWorkingSetSize(process, &minimum, &maximum)) {
+        return false;
+    }
+    return SetProcessWorkingSetSize(process, minimum * 4, maximum * 4) != 0;
+}
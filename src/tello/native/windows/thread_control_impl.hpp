@@ -0,0 +1,17 @@
+#pragma once
+
+#ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include "../thread_control_interface.hpp"
+
+namespace tello::windows {
+
+    class ThreadControlImpl : public ThreadControlInterface {
+    public:
+        bool pin(std::thread& thread, int cpu) override;
+        bool prioritize(std::thread& thread, int priority) override;
+        bool lockMemory() override;
+    };
+}
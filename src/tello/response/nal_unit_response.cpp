@@ -0,0 +1,26 @@
+#include <tello/response/nal_unit_response.hpp>
+
+tello::NalUnitResponse::NalUnitResponse(const unsigned char* data, size_t length, bool lastInFrame,
+                                        int64_t receiveTime) :
+        Response(Status::OK), _data(data), _length(length), _lastInFrame(lastInFrame), _receiveTime(receiveTime) {}
+
+const unsigned char* tello::NalUnitResponse::data() const {
+    return _data;
+}
+
+size_t tello::NalUnitResponse::length() const {
+    return _length;
+}
+
+tello::NalUnitType tello::NalUnitResponse::type() const {
+    size_t header = _length > 2 && _data[2] == 1 ? 3 : 4;
+    return header < _length ? nalUnitType(_data[header]) : NalUnitType::UNSPECIFIED;
+}
+
+bool tello::NalUnitResponse::lastInFrame() const {
+    return _lastInFrame;
+}
+
+int64_t tello::NalUnitResponse::receiveTime() const {
+    return _receiveTime;
+}
@@ -1,48 +1,14 @@
-#include <iostream>
 #include <tello/response/status_response.hpp>
-#include <sstream>
 
-using std::stringstream;
-
-tello::StatusResponse::StatusResponse(const string &response) :
-        Response(Status::OK), values(unordered_map<string, string>()) {
-
-    stringstream ss(response);
-    while (ss) {
-        string keyValue{};
-        std::string key{}, value{};
-        {
-            getline(ss, keyValue, ';');
-
-            stringstream kvs(keyValue);
-            string key, value;
-            getline(kvs, key, ':');
-            getline(kvs, value);
-
-            values[key] = value;
-        }
-    }
+tello::StatusResponse::StatusResponse(const string &response) : Response(Status::OK), _sample() {
+    StatusSample::parse(response.c_str(), response.length(), _sample);
 }
 
-
-float tello::StatusResponse::readFloat(string &&key, float defaultValue) const {
-    if (values.empty()) {
-        return defaultValue;
-    }
-
-    auto item = values.find(key);
-    float value = stof(item->second);
-    return value;
+tello::StatusResponse::StatusResponse(const StatusSample& sample) : Response(Status::OK), _sample(sample) {
 }
 
-int tello::StatusResponse::readInt(string &&key, int defaultValue) const {
-    if (values.empty()) {
-        return defaultValue;
-    }
-
-    auto item = values.find(key);
-    int value = stoi(item->second);
-    return value;
+const tello::StatusSample& tello::StatusResponse::sample() const {
+    return _sample;
 }
 
 
@@ -53,90 +19,81 @@ string tello::StatusResponse::get_mpry() const {
 
 
 int tello::StatusResponse::get_x() const {
-    return readInt(string("x"), 0);
+    return _sample._x;
 }
 
 int tello::StatusResponse::get_y() const {
-    return readInt(string("y"), 0);
+    return _sample._y;
 }
 
 int tello::StatusResponse::get_z() const {
-    return readInt(string("z"), 0);
+    return _sample._z;
 }
 
 
 int tello::StatusResponse::get_vgx() const {
-    return readInt(string("vgx"), 0);
+    return _sample._vgx;
 }
 
 int tello::StatusResponse::get_vgy() const {
-    return readInt(string("vgy"), 0);
+    return _sample._vgy;
 }
 
 int tello::StatusResponse::get_vgz() const {
-    return readInt(string("vgz"), 0);
+    return _sample._vgz;
 }
 
 
 float tello::StatusResponse::get_agx() const {
-    return readFloat(string("agx"), 0.0f);
+    return _sample._agx;
 }
 
 float tello::StatusResponse::get_agy() const {
-    return readFloat(string("agy"), 0.0f);
+    return _sample._agy;
 }
 
 float tello::StatusResponse::get_agz() const {
-    return readFloat(string("agz"), 0.0f);
+    return _sample._agz;
 }
 
 
 int tello::StatusResponse::get_pitch() const {
-    return readInt(string("pitch"), 0);
+    return _sample._pitch;
 }
 
 int tello::StatusResponse::get_roll() const {
-    return readInt(string("roll"), 0);
+    return _sample._roll;
 }
 
 int tello::StatusResponse::get_bat() const {
-    return readInt(string("bat"), 0);
+    return _sample._bat;
 }
 
 int tello::StatusResponse::get_yaw() const {
-    return readInt(string("yaw"), 0);
+    return _sample._yaw;
 }
 
 int tello::StatusResponse::get_templ() const {
-    return readInt(string("templ"), 0);
+    return _sample._templ;
 }
 
 int tello::StatusResponse::get_temph() const {
-    return readInt(string("temph"), 0);
+    return _sample._temph;
 }
 
 
 int tello::StatusResponse::get_tof() const {
-    return readInt(string("tof"), 0);
+    return _sample._tof;
 }
 
 int tello::StatusResponse::get_h() const {
-    return readInt(string("h"), 0);
+    return _sample._h;
 }
 
 float tello::StatusResponse::get_baro() const {
-    return readFloat(string("baro"), 0);
+    return _sample._baro;
 }
 
 int tello::StatusResponse::get_time() const {
-    return readInt(string("time"), 0);
+    return _sample._time;
 }
-
-
-int get_pitch();
-
-int get_roll();
-
-int get_bat();
-
-int get_yaw();
\ No newline at end of file
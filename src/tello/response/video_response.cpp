@@ -2,56 +2,36 @@
 
 #include <cstring>
 
-tello::VideoResponse::VideoResponse(unsigned char* videoFrame, unsigned int length) :
-        Response(Status::OK),
-        _videoFrame(reinterpret_cast<unsigned char*>(std::memcpy(new unsigned char[length], videoFrame, length))),
-        _length(length){}
-
-tello::VideoResponse::VideoResponse(const VideoResponse& other) :
-        Response(other),
-        _length(other.length()) {
-    delete[] _videoFrame;
-    _videoFrame = reinterpret_cast<unsigned char*>(std::memcpy(new unsigned char[other.length()], other._videoFrame,
-                                                             other.length()));
-}
+namespace {
 
-tello::VideoResponse& tello::VideoResponse::operator=(const VideoResponse& other) {
-    if (this == &other) {
-        return *this;
+    tello::FrameHandle copyFrame(const unsigned char* videoFrame, unsigned int length) {
+        auto* frame = new tello::FrameBuffer(length > 0 ? length : 1);
+        std::memcpy(frame->tail(), videoFrame, length);
+        frame->commit(length);
+        return tello::FrameHandle{frame};
     }
-
-    delete[] _videoFrame;
-    _videoFrame = reinterpret_cast<unsigned char*>(std::memcpy(new unsigned char[other.length()], other._videoFrame,
-                                                               other.length()));
-    _length = other._length;
-    return *this;
 }
 
-tello::VideoResponse::VideoResponse(VideoResponse&& other) noexcept :
-    _videoFrame(other._videoFrame),
-    _length(other._length) {
-    other._videoFrame = nullptr;
-    other._length = 0;
-}
+tello::VideoResponse::VideoResponse(const unsigned char* videoFrame, unsigned int length) :
+        Response(Status::OK),
+        _frame(copyFrame(videoFrame, length)) {}
 
-tello::VideoResponse& tello::VideoResponse::operator=(VideoResponse&& other) noexcept {
-    this->_videoFrame = other._videoFrame;
-    this->_length = other._length;
+tello::VideoResponse::VideoResponse(FrameHandle frame) :
+        Response(Status::OK),
+        _frame(std::move(frame)) {}
 
-    other._videoFrame = nullptr;
-    other._length = 0;
-    return *this;
+const unsigned char* tello::VideoResponse::videoFrame() const {
+    return _frame.data();
 }
 
-tello::VideoResponse::~VideoResponse() {
-    delete[] _videoFrame;
-    _videoFrame = nullptr;
+unsigned int tello::VideoResponse::length() const {
+    return static_cast<unsigned int>(_frame.length());
 }
 
-unsigned char* tello::VideoResponse::videoFrame() const {
-    return _videoFrame;
+const tello::FrameHandle& tello::VideoResponse::frame() const {
+    return _frame;
 }
 
-unsigned int tello::VideoResponse::length() const {
-    return _length;
-}
\ No newline at end of file
+const tello::FrameInfo& tello::VideoResponse::info() const {
+    return _frame.info();
+}
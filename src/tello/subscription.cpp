@@ -0,0 +1,39 @@
+#include <tello/subscription.hpp>
+
+tello::Subscription::Subscription() : _source(), _id(0) {
+}
+
+tello::Subscription::Subscription(weak_ptr<SubscriptionSource> source, uint64_t id) : _source(std::move(source)),
+                                                                                      _id(id) {
+}
+
+tello::Subscription::Subscription(Subscription&& other) noexcept : _source(std::move(other._source)),
+                                                                  _id(other._id) {
+    other._source.reset();
+}
+
+tello::Subscription& tello::Subscription::operator=(Subscription&& other) noexcept {
+    if (this != &other) {
+        unsubscribe();
+        _source = std::move(other._source);
+        _id = other._id;
+        other._source.reset();
+    }
+    return *this;
+}
+
+tello::Subscription::~Subscription() {
+    unsubscribe();
+}
+
+void tello::Subscription::unsubscribe() {
+    shared_ptr<SubscriptionSource> source = _source.lock();
+    if (source != nullptr) {
+        source->unsubscribe(_id);
+    }
+    _source.reset();
+}
+
+bool tello::Subscription::active() const {
+    return !_source.expired();
+}
@@ -0,0 +1,275 @@
+#include "archive_codec.hpp"
+
+namespace {
+
+    class BitWriter {
+    public:
+        explicit BitWriter(vector<uint8_t>& out) : _out(out), _current(0), _used(0) {}
+
+        void write(uint32_t value, int bits) {
+            for (int i = bits - 1; i >= 0; i--) {
+                _current = static_cast<uint8_t>((_current << 1) | ((value >> i) & 1));
+                if (++_used == 8) {
+                    _out.push_back(_current);
+                    _current = 0;
+                    _used = 0;
+                }
+            }
+        }
+
+        void finish() {
+            if (_used > 0) {
+                _out.push_back(static_cast<uint8_t>(_current << (8 - _used)));
+                _current = 0;
+                _used = 0;
+            }
+        }
+
+    private:
+        vector<uint8_t>& _out;
+        uint8_t _current;
+        int _used;
+    };
+
+    class BitReader {
+    public:
+        BitReader(const uint8_t* data, size_t length) : _data(data), _length(length), _position(0) {}
+
+        bool read(int bits, uint32_t& value) {
+            if (_position + bits > _length * 8) {
+                return false;
+            }
+            value = 0;
+            for (int i = 0; i < bits; i++, _position++) {
+                value = (value << 1) | ((_data[_position >> 3] >> (7 - (_position & 7))) & 1);
+            }
+            return true;
+        }
+
+    private:
+        const uint8_t* _data;
+        size_t _length;
+        size_t _position;
+    };
+
+    int leadingZeros(uint32_t value) {
+        int count = 0;
+        for (uint32_t mask = 0x80000000u; mask != 0 && (value & mask) == 0; mask >>= 1) {
+            count++;
+        }
+        return count;
+    }
+
+    int trailingZeros(uint32_t value) {
+        int count = 0;
+        for (uint32_t mask = 1; mask != 0 && (value & mask) == 0; mask <<= 1) {
+            count++;
+        }
+        return count;
+    }
+}
+
+void tello::telemetry::ArchiveCodec::writeVarint(uint64_t value, vector<uint8_t>& out) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool tello::telemetry::ArchiveCodec::readVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && data < end; shift += 7) {
+        uint8_t byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void tello::telemetry::ArchiveCodec::encodeTimestamps(const int64_t* values, size_t count, vector<uint8_t>& out) {
+    int64_t previousDelta = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i == 0) {
+            writeVarint(zigzag(values[0]), out);
+        } else {
+            int64_t delta = values[i] - values[i - 1];
+            writeVarint(zigzag(i == 1 ? delta : delta - previousDelta), out);
+            previousDelta = delta;
+        }
+    }
+}
+
+bool tello::telemetry::ArchiveCodec::decodeTimestamps(const uint8_t* data, size_t length, size_t count,
+                                                      int64_t* values) {
+    const uint8_t* end = data + length;
+    int64_t previousDelta = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t encoded;
+        if (!readVarint(data, end, encoded)) {
+            return false;
+        }
+        if (i == 0) {
+            values[0] = unzigzag(encoded);
+        } else {
+            int64_t delta = i == 1 ? unzigzag(encoded) : previousDelta + unzigzag(encoded);
+            values[i] = values[i - 1] + delta;
+            previousDelta = delta;
+        }
+    }
+    return true;
+}
+
+void tello::telemetry::ArchiveCodec::encodeIntColumn(const uint32_t* values, size_t count, vector<uint8_t>& out) {
+    if (count == 0) {
+        return;
+    }
+    writeVarint(zigzag(static_cast<int32_t>(values[0])), out);
+
+    size_t i = 1;
+    while (i < count) {
+        int64_t delta = static_cast<int64_t>(static_cast<int32_t>(values[i])) - static_cast<int32_t>(values[i - 1]);
+        if (delta != 0) {
+            writeVarint(zigzag(delta), out);
+            i++;
+            continue;
+        }
+
+        size_t run = 1;
+        while (i + run < count && values[i + run] == values[i - 1]) {
+            run++;
+        }
+        writeVarint(0, out);
+        writeVarint(run, out);
+        i += run;
+    }
+}
+
+bool tello::telemetry::ArchiveCodec::decodeIntColumn(const uint8_t* data, size_t length, size_t count,
+                                                     uint32_t* values) {
+    if (count == 0) {
+        return true;
+    }
+    const uint8_t* end = data + length;
+    uint64_t encoded;
+    if (!readVarint(data, end, encoded)) {
+        return false;
+    }
+    values[0] = static_cast<uint32_t>(static_cast<int32_t>(unzigzag(encoded)));
+
+    size_t i = 1;
+    while (i < count) {
+        if (!readVarint(data, end, encoded)) {
+            return false;
+        }
+        if (encoded != 0) {
+            values[i] = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int32_t>(values[i - 1]) +
+                                                                   unzigzag(encoded)));
+            i++;
+            continue;
+        }
+
+        uint64_t run;
+        if (!readVarint(data, end, run) || run == 0 || i + run > count) {
+            return false;
+        }
+        for (uint64_t r = 0; r < run; r++, i++) {
+            values[i] = values[i - 1];
+        }
+    }
+    return true;
+}
+
+void tello::telemetry::ArchiveCodec::encodeFloatColumn(const uint32_t* values, size_t count, vector<uint8_t>& out) {
+    if (count == 0) {
+        return;
+    }
+    BitWriter writer(out);
+    writer.write(values[0], 32);
+
+    int previousLeading = -1;
+    int previousTrailing = 0;
+    for (size_t i = 1; i < count; i++) {
+        uint32_t xored = values[i] ^ values[i - 1];
+        if (xored == 0) {
+            writer.write(0, 1);
+            continue;
+        }
+        writer.write(1, 1);
+
+        int leading = leadingZeros(xored);
+        int trailing = trailingZeros(xored);
+        if (leading > 31) {
+            leading = 31;
+        }
+
+        if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing) {
+            // The meaningful bits fit into the window of the previous value.
+            writer.write(0, 1);
+            int meaningful = 32 - previousLeading - previousTrailing;
+            writer.write(xored >> previousTrailing, meaningful);
+        } else {
+            int meaningful = 32 - leading - trailing;
+            writer.write(1, 1);
+            writer.write(static_cast<uint32_t>(leading), 5);
+            writer.write(static_cast<uint32_t>(meaningful - 1), 5);
+            writer.write(xored >> trailing, meaningful);
+            previousLeading = leading;
+            previousTrailing = trailing;
+        }
+    }
+    writer.finish();
+}
+
+bool tello::telemetry::ArchiveCodec::decodeFloatColumn(const uint8_t* data, size_t length, size_t count,
+                                                       uint32_t* values) {
+    if (count == 0) {
+        return true;
+    }
+    BitReader reader(data, length);
+    if (!reader.read(32, values[0])) {
+        return false;
+    }
+
+    int previousLeading = -1;
+    int previousTrailing = 0;
+    for (size_t i = 1; i < count; i++) {
+        uint32_t bit;
+        if (!reader.read(1, bit)) {
+            return false;
+        }
+        if (bit == 0) {
+            values[i] = values[i - 1];
+            continue;
+        }
+
+        uint32_t control;
+        if (!reader.read(1, control)) {
+            return false;
+        }
+        if (control == 1) {
+            uint32_t leading;
+            uint32_t meaningful;
+            if (!reader.read(5, leading) || !reader.read(5, meaningful)) {
+                return false;
+            }
+            previousLeading = static_cast<int>(leading);
+            previousTrailing = 32 - previousLeading - static_cast<int>(meaningful + 1);
+            if (previousTrailing < 0) {
+                return false;
+            }
+        } else if (previousLeading < 0) {
+            return false;
+        }
+
+        int meaningful = 32 - previousLeading - previousTrailing;
+        uint32_t bits;
+        if (!reader.read(meaningful, bits)) {
+            return false;
+        }
+        values[i] = values[i - 1] ^ (bits << previousTrailing);
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+using std::vector;
+
+namespace tello::telemetry {
+
+    /**
+     * Column codecs of the telemetry archive. Every column is encoded into its own byte aligned section:
+     * - timestamps: first value, first delta, then zig-zag varint delta-of-deltas
+     * - integer fields: first value, then zig-zag varint deltas where a zero delta is followed by the
+     *   length of the zero run
+     * - float fields: XOR encoding against the previous value (Gorilla)
+     */
+    class ArchiveCodec {
+    public:
+        ArchiveCodec() = delete;
+
+        static void encodeTimestamps(const int64_t* values, size_t count, vector<uint8_t>& out);
+        static void encodeIntColumn(const uint32_t* values, size_t count, vector<uint8_t>& out);
+        static void encodeFloatColumn(const uint32_t* values, size_t count, vector<uint8_t>& out);
+
+        static bool decodeTimestamps(const uint8_t* data, size_t length, size_t count, int64_t* values);
+        static bool decodeIntColumn(const uint8_t* data, size_t length, size_t count, uint32_t* values);
+        static bool decodeFloatColumn(const uint8_t* data, size_t length, size_t count, uint32_t* values);
+
+        static void writeVarint(uint64_t value, vector<uint8_t>& out);
+        static bool readVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value);
+
+        static inline uint64_t zigzag(int64_t value) {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        static inline int64_t unzigzag(uint64_t value) {
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+    };
+}
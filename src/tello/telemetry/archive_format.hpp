@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+#define TELEMETRY_ARCHIVE_VERSION 1
+
+namespace tello::telemetry {
+
+    constexpr char ARCHIVE_MAGIC[8] = {'T', 'L', 'M', 'A', 'R', 'C', '0', '1'};
+
+    /**
+     * Layout of a telemetry archive:
+     * | header | block 0 | block 1 | ... | padding | TelemetryBlockIndex[blockCount] |
+     * A block is the varint sample count followed by the timestamp column and one column per
+     * StatusField, each prefixed with its varint byte length.
+     */
+    struct ArchiveFileHeader {
+        char _magic[8];
+        uint32_t _version;
+        uint32_t _fieldCount;
+        uint32_t _blockCapacity;
+        uint32_t _reserved;
+        uint64_t _drone;
+        uint64_t _blockCount;
+        uint64_t _indexOffset;
+    };
+}
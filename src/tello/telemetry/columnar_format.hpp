@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tello/telemetry/status_sample.hpp>
+
+#define TELEMETRY_COLUMNAR_VERSION 1
+#define TELEMETRY_COLUMNAR_ALIGNMENT 64
+
+namespace tello::telemetry {
+
+    constexpr char COLUMNAR_MAGIC[8] = {'T', 'L', 'M', 'C', 'O', 'L', '0', '1'};
+
+    struct ColumnStatistics {
+        double _min;
+        double _max;
+    };
+
+    /**
+     * Layout of a columnar telemetry file:
+     * | file header | block 0 | block 1 | ... |
+     * Every block has the same size and consists of a block header (the index of the block),
+     * the timestamp column and one fixed-width column per StatusField.
+     */
+    struct ColumnarFileHeader {
+        char _magic[8];
+        uint32_t _version;
+        uint32_t _fieldCount;
+        uint32_t _blockCapacity;
+        uint32_t _reserved;
+        uint64_t _drone;
+        uint64_t _blockSize;
+        uint64_t _blockCount;
+    };
+
+    struct ColumnarBlockHeader {
+        uint32_t _count;
+        uint32_t _capacity;
+        int64_t _firstTimestamp;
+        int64_t _lastTimestamp;
+        ColumnStatistics _statistics[STATUS_FIELD_COUNT];
+    };
+
+    constexpr size_t alignColumnar(size_t size) {
+        return (size + TELEMETRY_COLUMNAR_ALIGNMENT - 1) & ~static_cast<size_t>(TELEMETRY_COLUMNAR_ALIGNMENT - 1);
+    }
+
+    constexpr size_t columnarFileHeaderSize() {
+        return alignColumnar(sizeof(ColumnarFileHeader));
+    }
+
+    constexpr size_t columnarBlockHeaderSize() {
+        return alignColumnar(sizeof(ColumnarBlockHeader));
+    }
+
+    constexpr size_t columnarTimestampOffset() {
+        return columnarBlockHeaderSize();
+    }
+
+    constexpr size_t columnarColumnOffset(uint32_t capacity, StatusField field) {
+        return columnarBlockHeaderSize() + capacity * sizeof(int64_t) +
+               static_cast<size_t>(field) * capacity * sizeof(uint32_t);
+    }
+
+    constexpr size_t columnarBlockSize(uint32_t capacity) {
+        return alignColumnar(columnarColumnOffset(capacity, static_cast<StatusField>(STATUS_FIELD_COUNT)));
+    }
+}
@@ -0,0 +1,130 @@
+#include "columnar_writer.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include <tello/logger/logger_interface.hpp>
+#include <atomic>
+#include <cstring>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::StatusField;
+using tello::telemetry::ColumnarFileHeader;
+using tello::telemetry::ColumnarBlockHeader;
+
+tello::telemetry::ColumnarWriter::ColumnarWriter(ip_address drone, uint32_t blockCapacity)
+        : _drone(drone), _blockCapacity(blockCapacity), _map(MemoryMapFactory::build()) {}
+
+tello::telemetry::ColumnarWriter::~ColumnarWriter() {
+    flush();
+    _map->close();
+}
+
+bool tello::telemetry::ColumnarWriter::open(const string& path) {
+    // Continue an existing recording of the drone, the file is append-only.
+    if (_map->open(path, 0, true)) {
+        const ColumnarFileHeader* existing = header();
+        bool valid = _map->size() >= columnarFileHeaderSize() &&
+                     std::memcmp(existing->_magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) == 0 &&
+                     existing->_version == TELEMETRY_COLUMNAR_VERSION &&
+                     existing->_blockCapacity == _blockCapacity && existing->_drone == _drone;
+        if (!valid) {
+            LoggerInterface::error(LoggerType::STATUS, string("Telemetry file {} has an incompatible format"), path);
+            _map->close();
+            return false;
+        }
+        return true;
+    }
+
+    size_t size = columnarFileHeaderSize() + TELEMETRY_GROWTH_BLOCKS * columnarBlockSize(_blockCapacity);
+    if (!_map->open(path, size, true)) {
+        LoggerInterface::error(LoggerType::STATUS, string("Cannot map telemetry file {}"), path);
+        return false;
+    }
+
+    ColumnarFileHeader* fileHeader = header();
+    std::memset(fileHeader, 0, columnarFileHeaderSize());
+    std::memcpy(fileHeader->_magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    fileHeader->_version = TELEMETRY_COLUMNAR_VERSION;
+    fileHeader->_fieldCount = STATUS_FIELD_COUNT;
+    fileHeader->_blockCapacity = _blockCapacity;
+    fileHeader->_drone = _drone;
+    fileHeader->_blockSize = columnarBlockSize(_blockCapacity);
+    fileHeader->_blockCount = 0;
+    return true;
+}
+
+bool tello::telemetry::ColumnarWriter::append(int64_t timestamp, const StatusSample& sample) {
+    ColumnarFileHeader* fileHeader = header();
+    if (fileHeader->_blockCount == 0 ||
+        reinterpret_cast<ColumnarBlockHeader*>(block(fileHeader->_blockCount - 1))->_count == _blockCapacity) {
+        if (!addBlock()) {
+            return false;
+        }
+        fileHeader = header();
+    }
+
+    char* current = block(fileHeader->_blockCount - 1);
+    auto* blockHeader = reinterpret_cast<ColumnarBlockHeader*>(current);
+    uint32_t index = blockHeader->_count;
+
+    reinterpret_cast<int64_t*>(current + columnarTimestampOffset())[index] = timestamp;
+    for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+        auto field = static_cast<StatusField>(i);
+        reinterpret_cast<uint32_t*>(current + columnarColumnOffset(_blockCapacity, field))[index] = sample.bits(field);
+
+        double value = sample.value(field);
+        ColumnStatistics& statistics = blockHeader->_statistics[i];
+        if (index == 0 || value < statistics._min) {
+            statistics._min = value;
+        }
+        if (index == 0 || value > statistics._max) {
+            statistics._max = value;
+        }
+    }
+
+    if (index == 0) {
+        blockHeader->_firstTimestamp = timestamp;
+    }
+    blockHeader->_lastTimestamp = timestamp;
+
+    // Readers mapping the file concurrently only look at published rows.
+    std::atomic_thread_fence(std::memory_order_release);
+    blockHeader->_count = index + 1;
+    return true;
+}
+
+void tello::telemetry::ColumnarWriter::flush() {
+    _map->flush();
+}
+
+ColumnarFileHeader* tello::telemetry::ColumnarWriter::header() const {
+    return reinterpret_cast<ColumnarFileHeader*>(_map->data());
+}
+
+char* tello::telemetry::ColumnarWriter::block(uint64_t index) const {
+    return _map->data() + columnarFileHeaderSize() + index * header()->_blockSize;
+}
+
+bool tello::telemetry::ColumnarWriter::addBlock() {
+    uint64_t blockCount = header()->_blockCount;
+    size_t blockSize = header()->_blockSize;
+    size_t required = columnarFileHeaderSize() + (blockCount + 1) * blockSize;
+
+    if (required > _map->size()) {
+        _map->flush();
+        if (!_map->resize(_map->size() + TELEMETRY_GROWTH_BLOCKS * blockSize)) {
+            LoggerInterface::error(LoggerType::STATUS, string("Cannot grow telemetry file of {}"),
+                                   std::to_string(_drone));
+            return false;
+        }
+    }
+
+    char* next = block(blockCount);
+    std::memset(next, 0, columnarBlockHeaderSize());
+    auto* blockHeader = reinterpret_cast<ColumnarBlockHeader*>(next);
+    blockHeader->_capacity = _blockCapacity;
+
+    header()->_blockCount = blockCount + 1;
+    return true;
+}
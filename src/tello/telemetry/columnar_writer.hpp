@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <tello/telemetry/status_sample.hpp>
+#include "columnar_format.hpp"
+
+#define TELEMETRY_GROWTH_BLOCKS 16
+
+using std::string;
+using std::unique_ptr;
+using ip_address = unsigned long;
+
+namespace tello {
+    class MemoryMapInterface;
+}
+
+namespace tello::telemetry {
+
+    /**
+     * Appends samples of one drone to a memory mapped columnar file.
+     * Not thread safe, owned by the writer thread of the TelemetryRecorder.
+     */
+    class ColumnarWriter {
+    public:
+        ColumnarWriter(ip_address drone, uint32_t blockCapacity);
+        ColumnarWriter(const ColumnarWriter&) = delete;
+        ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+        ~ColumnarWriter();
+
+        bool open(const string& path);
+        bool append(int64_t timestamp, const StatusSample& sample);
+        void flush();
+
+    private:
+        const ip_address _drone;
+        const uint32_t _blockCapacity;
+        unique_ptr<MemoryMapInterface> _map;
+
+        [[nodiscard]] ColumnarFileHeader* header() const;
+        [[nodiscard]] char* block(uint64_t index) const;
+        bool addBlock();
+    };
+}
@@ -0,0 +1,76 @@
+#include <tello/telemetry/status_filter.hpp>
+#include <cmath>
+
+using tello::StatusField;
+
+tello::StatusFilter::StatusFilter() : _deadbands(), _hasDeadband(false), _minInterval(0), _onChangeOnly(false),
+                                      _lastSample(), _lastTimestamp(0), _delivered(false) {
+    for (double& deadband : _deadbands) {
+        deadband = -1.0;
+    }
+}
+
+tello::StatusFilter& tello::StatusFilter::deadband(StatusField field, double threshold) {
+    _deadbands[static_cast<int>(field)] = threshold;
+    _hasDeadband = false;
+    for (double deadband : _deadbands) {
+        _hasDeadband = _hasDeadband || deadband >= 0.0;
+    }
+    return *this;
+}
+
+tello::StatusFilter& tello::StatusFilter::maxRate(double hertz) {
+    _minInterval = hertz > 0.0 ? static_cast<int64_t>(1000000.0 / hertz) : 0;
+    return *this;
+}
+
+tello::StatusFilter& tello::StatusFilter::onChangeOnly(bool onChangeOnly) {
+    _onChangeOnly = onChangeOnly;
+    return *this;
+}
+
+bool tello::StatusFilter::passesAll() const {
+    return !_hasDeadband && !_onChangeOnly && _minInterval == 0;
+}
+
+bool tello::StatusFilter::accept(const StatusSample& sample, int64_t timestamp) {
+    if (passesAll()) {
+        return true;
+    }
+
+    if (_delivered) {
+        if (_minInterval > 0 && timestamp - _lastTimestamp < _minInterval) {
+            return false;
+        }
+        if (!changed(sample)) {
+            return false;
+        }
+    }
+
+    _lastSample = sample;
+    _lastTimestamp = timestamp;
+    _delivered = true;
+    return true;
+}
+
+void tello::StatusFilter::reset() {
+    _delivered = false;
+}
+
+bool tello::StatusFilter::changed(const StatusSample& sample) const {
+    if (!_hasDeadband && !_onChangeOnly) {
+        return true;
+    }
+
+    for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+        auto field = static_cast<StatusField>(i);
+        if (_deadbands[i] >= 0.0) {
+            if (std::fabs(sample.value(field) - _lastSample.value(field)) >= _deadbands[i]) {
+                return true;
+            }
+        } else if (_onChangeOnly && sample.bits(field) != _lastSample.bits(field)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,72 @@
+#include <tello/telemetry/status_queue.hpp>
+
+using tello::QueuedStatus;
+using tello::StatusDropPolicy;
+using tello::StatusQueueStatistics;
+
+tello::StatusQueue::StatusQueue(size_t capacity, StatusDropPolicy policy)
+        : _mutex(), _ring(capacity > 0 ? capacity : 1), _head(0), _size(0), _policy(policy), _draining(false),
+          _statistics() {
+}
+
+void tello::StatusQueue::configure(size_t capacity, StatusDropPolicy policy) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    capacity = capacity > 0 ? capacity : 1;
+    _policy = policy;
+
+    // the newest updates are kept
+    size_t kept = _size < capacity ? _size : capacity;
+    vector<QueuedStatus> ring(capacity);
+    for (size_t i = 0; i < kept; i++) {
+        ring[i] = _ring[(_head + _size - kept + i) % _ring.size()];
+    }
+    _statistics._dropped += _size - kept;
+    _ring = std::move(ring);
+    _head = 0;
+    _size = kept;
+}
+
+bool tello::StatusQueue::push(const StatusSample& sample, int64_t timestamp, uint64_t accepted) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _statistics._enqueued++;
+
+    if (_size == _ring.size()) {
+        _statistics._dropped++;
+        if (_policy == StatusDropPolicy::DROP_NEWEST) {
+            return false;
+        }
+        _head = (_head + 1) % _ring.size();
+        _size--;
+    }
+
+    _ring[(_head + _size) % _ring.size()] = QueuedStatus{sample, timestamp, accepted};
+    _size++;
+    if (_size > _statistics._maxDepth) {
+        _statistics._maxDepth = _size;
+    }
+
+    bool idle = !_draining;
+    _draining = true;
+    return idle;
+}
+
+optional<QueuedStatus> tello::StatusQueue::pop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_size == 0) {
+        _draining = false;
+        return std::nullopt;
+    }
+
+    QueuedStatus status = _ring[_head];
+    _head = (_head + 1) % _ring.size();
+    _size--;
+    _statistics._delivered++;
+    return status;
+}
+
+StatusQueueStatistics tello::StatusQueue::statistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    StatusQueueStatistics statistics = _statistics;
+    statistics._depth = _size;
+    return statistics;
+}
@@ -0,0 +1,149 @@
+#include <tello/telemetry/status_sample.hpp>
+#include <cstring>
+
+using tello::StatusField;
+using tello::StatusSample;
+
+namespace {
+
+    const char* const FIELD_NAMES[STATUS_FIELD_COUNT] = {
+            "mid", "x", "y", "z", "pitch", "roll", "yaw", "vgx", "vgy", "vgz",
+            "templ", "temph", "tof", "h", "bat", "baro", "time", "agx", "agy", "agz"
+    };
+
+    optional<StatusField> findField(const char* key, size_t length) {
+        for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+            const char* name = FIELD_NAMES[i];
+            if (std::strlen(name) == length && std::memcmp(name, key, length) == 0) {
+                return static_cast<StatusField>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool parseInt(const char* begin, const char* end, int32_t& result) {
+        bool negative = begin != end && *begin == '-';
+        if (negative || (begin != end && *begin == '+')) {
+            ++begin;
+        }
+        if (begin == end) {
+            return false;
+        }
+
+        // INT32_MIN has no positive counterpart, so the negative range reaches one further
+        const int64_t limit = negative ? static_cast<int64_t>(INT32_MAX) + 1 : INT32_MAX;
+        int64_t value = 0;
+        for (; begin != end; ++begin) {
+            if (*begin < '0' || *begin > '9') {
+                return false;
+            }
+            value = value * 10 + (*begin - '0');
+            if (value > limit) {
+                return false;
+            }
+        }
+        result = static_cast<int32_t>(negative ? -value : value);
+        return true;
+    }
+
+    bool parseFloat(const char* begin, const char* end, float& result) {
+        bool negative = begin != end && *begin == '-';
+        if (negative || (begin != end && *begin == '+')) {
+            ++begin;
+        }
+        if (begin == end) {
+            return false;
+        }
+
+        double value = 0.0;
+        for (; begin != end && *begin >= '0' && *begin <= '9'; ++begin) {
+            value = value * 10.0 + (*begin - '0');
+        }
+        if (begin != end && *begin == '.') {
+            double scale = 0.1;
+            for (++begin; begin != end && *begin >= '0' && *begin <= '9'; ++begin) {
+                value += (*begin - '0') * scale;
+                scale *= 0.1;
+            }
+        }
+        result = static_cast<float>(negative ? -value : value);
+        return true;
+    }
+}
+
+bool tello::isFloatField(StatusField field) {
+    return field == StatusField::BARO || field == StatusField::AGX || field == StatusField::AGY ||
+           field == StatusField::AGZ;
+}
+
+const char* tello::fieldName(StatusField field) {
+    return FIELD_NAMES[static_cast<int>(field)];
+}
+
+optional<StatusField> tello::fieldByName(const string& name) {
+    return findField(name.c_str(), name.length());
+}
+
+double tello::StatusSample::value(StatusField field) const {
+    uint32_t word = bits(field);
+    if (isFloatField(field)) {
+        float value;
+        std::memcpy(&value, &word, sizeof(value));
+        return value;
+    }
+    int32_t value;
+    std::memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+uint32_t tello::StatusSample::bits(StatusField field) const {
+    uint32_t word;
+    std::memcpy(&word, reinterpret_cast<const char*>(&_mid) + static_cast<int>(field) * sizeof(uint32_t),
+                sizeof(word));
+    return word;
+}
+
+void tello::StatusSample::setBits(StatusField field, uint32_t bits) {
+    std::memcpy(reinterpret_cast<char*>(&_mid) + static_cast<int>(field) * sizeof(uint32_t), &bits, sizeof(bits));
+}
+
+bool tello::StatusSample::parse(const char* data, size_t length, StatusSample& sample) {
+    static_assert(sizeof(StatusSample) == STATUS_FIELD_COUNT * sizeof(uint32_t), "StatusSample must be packed");
+
+    bool found = false;
+    const char* position = data;
+    const char* const end = data + length;
+
+    while (position < end && *position != '\0') {
+        const char* separator = position;
+        while (separator < end && *separator != ';' && *separator != '\0') {
+            ++separator;
+        }
+
+        const char* colon = static_cast<const char*>(std::memchr(position, ':', separator - position));
+        if (colon != nullptr) {
+            optional<StatusField> field = findField(position, colon - position);
+            if (field) {
+                if (isFloatField(*field)) {
+                    float value;
+                    if (parseFloat(colon + 1, separator, value)) {
+                        uint32_t word;
+                        std::memcpy(&word, &value, sizeof(word));
+                        sample.setBits(*field, word);
+                        found = true;
+                    }
+                } else {
+                    int32_t value;
+                    if (parseInt(colon + 1, separator, value)) {
+                        sample.setBits(*field, static_cast<uint32_t>(value));
+                        found = true;
+                    }
+                }
+            }
+        }
+
+        position = separator + 1;
+    }
+
+    return found;
+}
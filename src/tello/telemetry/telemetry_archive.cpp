@@ -0,0 +1,282 @@
+#include <tello/telemetry/telemetry_archive.hpp>
+#include <tello/telemetry/telemetry_reader.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "archive_codec.hpp"
+#include "archive_format.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include <cstring>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::StatusField;
+using tello::TelemetryBlockIndex;
+using tello::telemetry::ArchiveCodec;
+using tello::telemetry::ArchiveFileHeader;
+using tello::telemetry::ARCHIVE_MAGIC;
+
+double tello::TelemetryColumns::value(StatusField field, size_t index) const {
+    uint32_t word = _columns[static_cast<int>(field)][index];
+    if (isFloatField(field)) {
+        float value;
+        std::memcpy(&value, &word, sizeof(value));
+        return value;
+    }
+    return static_cast<int32_t>(word);
+}
+
+tello::TelemetryArchiveWriter::TelemetryArchiveWriter(unsigned int blockCapacity)
+        : _blockCapacity(blockCapacity), _out(), _drone(0), _timestamps(), _columns(), _index(), _buffer(),
+          _rawBytes(0), _encodedBytes(0) {}
+
+tello::TelemetryArchiveWriter::~TelemetryArchiveWriter() {
+    close();
+}
+
+bool tello::TelemetryArchiveWriter::open(const string& path, ip_address drone) {
+    close();
+    _out.open(path, std::ios::binary | std::ios::trunc);
+    if (!_out) {
+        LoggerInterface::error(LoggerType::STATUS, string("Cannot open telemetry archive {}"), path);
+        return false;
+    }
+
+    _drone = drone;
+    _index.clear();
+    _rawBytes = 0;
+    _encodedBytes = sizeof(ArchiveFileHeader);
+    _timestamps.reserve(_blockCapacity);
+    for (auto& column : _columns) {
+        column.reserve(_blockCapacity);
+    }
+
+    // The header is rewritten with the index position on close.
+    ArchiveFileHeader header{};
+    _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return static_cast<bool>(_out);
+}
+
+bool tello::TelemetryArchiveWriter::append(int64_t timestamp, const StatusSample& sample) {
+    if (!_out.is_open()) {
+        return false;
+    }
+
+    _timestamps.push_back(timestamp);
+    for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+        _columns[i].push_back(sample.bits(static_cast<StatusField>(i)));
+    }
+    _rawBytes += sizeof(int64_t) + STATUS_FIELD_COUNT * sizeof(uint32_t);
+
+    return _timestamps.size() < _blockCapacity || writeBlock();
+}
+
+bool tello::TelemetryArchiveWriter::close() {
+    if (!_out.is_open()) {
+        return false;
+    }
+
+    bool written = _timestamps.empty() || writeBlock();
+
+    auto position = static_cast<uint64_t>(_out.tellp());
+    uint64_t indexOffset = (position + alignof(TelemetryBlockIndex) - 1) & ~(alignof(TelemetryBlockIndex) - 1);
+    const char padding[alignof(TelemetryBlockIndex)] = {};
+    _out.write(padding, static_cast<std::streamsize>(indexOffset - position));
+    _out.write(reinterpret_cast<const char*>(_index.data()),
+               static_cast<std::streamsize>(_index.size() * sizeof(TelemetryBlockIndex)));
+    _encodedBytes += indexOffset - position + _index.size() * sizeof(TelemetryBlockIndex);
+
+    ArchiveFileHeader header{};
+    std::memcpy(header._magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    header._version = TELEMETRY_ARCHIVE_VERSION;
+    header._fieldCount = STATUS_FIELD_COUNT;
+    header._blockCapacity = _blockCapacity;
+    header._drone = _drone;
+    header._blockCount = _index.size();
+    header._indexOffset = indexOffset;
+    _out.seekp(0);
+    _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    written = written && static_cast<bool>(_out);
+    _out.close();
+    return written;
+}
+
+unsigned long long tello::TelemetryArchiveWriter::rawBytes() const {
+    return _rawBytes;
+}
+
+unsigned long long tello::TelemetryArchiveWriter::encodedBytes() const {
+    return _encodedBytes;
+}
+
+bool tello::TelemetryArchiveWriter::convert(const TelemetryReader& reader, const string& path,
+                                            unsigned int blockCapacity) {
+    TelemetryArchiveWriter writer(blockCapacity);
+    if (!writer.open(path, reader.drone())) {
+        return false;
+    }
+
+    for (size_t b = 0; b < reader.blockCount(); b++) {
+        TelemetryBlock block = reader.block(b);
+        const int64_t* timestamps = block.timestamps();
+        for (unsigned int i = 0; i < block.count(); i++) {
+            if (!writer.append(timestamps[i], block.sample(i))) {
+                return false;
+            }
+        }
+    }
+    return writer.close();
+}
+
+bool tello::TelemetryArchiveWriter::writeBlock() {
+    size_t count = _timestamps.size();
+    TelemetryBlockIndex index{};
+    index._offset = static_cast<uint64_t>(_out.tellp());
+    index._count = static_cast<uint32_t>(count);
+    index._firstTimestamp = _timestamps.front();
+    index._lastTimestamp = _timestamps.back();
+
+    _buffer.clear();
+    ArchiveCodec::writeVarint(count, _buffer);
+
+    vector<uint8_t> column;
+    ArchiveCodec::encodeTimestamps(_timestamps.data(), count, column);
+    ArchiveCodec::writeVarint(column.size(), _buffer);
+    _buffer.insert(_buffer.end(), column.begin(), column.end());
+
+    for (int f = 0; f < STATUS_FIELD_COUNT; f++) {
+        auto field = static_cast<StatusField>(f);
+        column.clear();
+        if (isFloatField(field)) {
+            ArchiveCodec::encodeFloatColumn(_columns[f].data(), count, column);
+        } else {
+            ArchiveCodec::encodeIntColumn(_columns[f].data(), count, column);
+        }
+        ArchiveCodec::writeVarint(column.size(), _buffer);
+        _buffer.insert(_buffer.end(), column.begin(), column.end());
+
+        StatusSample sample;
+        for (size_t i = 0; i < count; i++) {
+            sample.setBits(field, _columns[f][i]);
+            double value = sample.value(field);
+            if (i == 0 || value < index._min[f]) {
+                index._min[f] = value;
+            }
+            if (i == 0 || value > index._max[f]) {
+                index._max[f] = value;
+            }
+        }
+        _columns[f].clear();
+    }
+    _timestamps.clear();
+
+    index._size = _buffer.size();
+    _out.write(reinterpret_cast<const char*>(_buffer.data()), static_cast<std::streamsize>(_buffer.size()));
+    _encodedBytes += _buffer.size();
+    _index.push_back(index);
+    return static_cast<bool>(_out);
+}
+
+tello::TelemetryArchiveReader::TelemetryArchiveReader() : _map(MemoryMapFactory::build()), _index(nullptr),
+                                                           _blockCount(0) {}
+
+tello::TelemetryArchiveReader::~TelemetryArchiveReader() = default;
+
+bool tello::TelemetryArchiveReader::open(const string& path) {
+    close();
+    if (!_map->open(path, 0, false)) {
+        LoggerInterface::error(LoggerType::STATUS, string("Cannot map telemetry archive {}"), path);
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const ArchiveFileHeader*>(_map->data());
+    bool valid = _map->size() >= sizeof(ArchiveFileHeader) &&
+                 std::memcmp(header->_magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) == 0 &&
+                 header->_version == TELEMETRY_ARCHIVE_VERSION && header->_fieldCount == STATUS_FIELD_COUNT &&
+                 header->_indexOffset % alignof(TelemetryBlockIndex) == 0 &&
+                 header->_indexOffset + header->_blockCount * sizeof(TelemetryBlockIndex) <= _map->size();
+    if (!valid) {
+        LoggerInterface::error(LoggerType::STATUS, string("{} is not a telemetry archive"), path);
+        close();
+        return false;
+    }
+
+    _index = reinterpret_cast<const TelemetryBlockIndex*>(_map->data() + header->_indexOffset);
+    _blockCount = header->_blockCount;
+    return true;
+}
+
+void tello::TelemetryArchiveReader::close() {
+    _map->close();
+    _index = nullptr;
+    _blockCount = 0;
+}
+
+ip_address tello::TelemetryArchiveReader::drone() const {
+    return static_cast<ip_address>(reinterpret_cast<const ArchiveFileHeader*>(_map->data())->_drone);
+}
+
+size_t tello::TelemetryArchiveReader::blockCount() const {
+    return _blockCount;
+}
+
+const TelemetryBlockIndex& tello::TelemetryArchiveReader::index(size_t block) const {
+    return _index[block];
+}
+
+unsigned long long tello::TelemetryArchiveReader::sampleCount() const {
+    unsigned long long count = 0;
+    for (size_t i = 0; i < _blockCount; i++) {
+        count += _index[i]._count;
+    }
+    return count;
+}
+
+bool tello::TelemetryArchiveReader::decode(size_t block, TelemetryColumns& columns, const FieldSelection& fields,
+                                           bool timestamps) const {
+    const TelemetryBlockIndex& index = _index[block];
+    if (index._offset + index._size > _map->size()) {
+        return false;
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>(_map->data() + index._offset);
+    const uint8_t* end = data + index._size;
+
+    uint64_t count;
+    if (!ArchiveCodec::readVarint(data, end, count) || count != index._count) {
+        return false;
+    }
+    columns._count = count;
+
+    for (int c = -1; c < STATUS_FIELD_COUNT; c++) {
+        uint64_t length;
+        if (!ArchiveCodec::readVarint(data, end, length) || length > static_cast<uint64_t>(end - data)) {
+            return false;
+        }
+
+        bool decoded = true;
+        if (c < 0) {
+            columns._timestamps.clear();
+            if (timestamps) {
+                columns._timestamps.resize(count);
+                decoded = ArchiveCodec::decodeTimestamps(data, length, count, columns._timestamps.data());
+            }
+        } else {
+            auto field = static_cast<StatusField>(c);
+            vector<uint32_t>& column = columns._columns[c];
+            column.clear();
+            if (fields.test(c)) {
+                column.resize(count);
+                decoded = isFloatField(field) ? ArchiveCodec::decodeFloatColumn(data, length, count, column.data())
+                                              : ArchiveCodec::decodeIntColumn(data, length, count, column.data());
+            }
+        }
+
+        if (!decoded) {
+            return false;
+        }
+        data += length;
+    }
+    return true;
+}
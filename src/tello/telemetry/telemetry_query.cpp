@@ -0,0 +1,297 @@
+#include <tello/telemetry/telemetry_query.hpp>
+#include <tello/telemetry/telemetry_reader.hpp>
+#include "../thread/thread_pool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#define COLUMNAR_EXTENSION ".tcol"
+
+using tello::FieldAggregate;
+using tello::FieldSelection;
+using tello::StatusField;
+using tello::TelemetryAggregate;
+using tello::TelemetryArchiveReader;
+using tello::TelemetryBlock;
+using tello::TelemetryColumns;
+using tello::TelemetryQuery;
+using tello::TelemetryQueryResult;
+using tello::TelemetryReader;
+using tello::threading::Threadpool;
+
+namespace {
+
+    struct Recording {
+        string _path;
+        unique_ptr<TelemetryArchiveReader> _archive;
+        unique_ptr<TelemetryReader> _columnar;
+        ip_address _drone = 0;
+        int64_t _origin = 0;
+        size_t _blocks = 0;
+        size_t _firstTask = 0;
+    };
+
+    struct ArchiveColumns {
+        const TelemetryColumns& _columns;
+
+        [[nodiscard]] int64_t timestamp(size_t index) const {
+            return _columns._timestamps[index];
+        }
+
+        [[nodiscard]] double value(StatusField field, size_t index) const {
+            return _columns.value(field, index);
+        }
+    };
+
+    struct ColumnarColumns {
+        const TelemetryBlock& _block;
+
+        [[nodiscard]] int64_t timestamp(size_t index) const {
+            return _block.timestamps()[index];
+        }
+
+        [[nodiscard]] double value(StatusField field, size_t index) const {
+            return _block.value(field, static_cast<unsigned int>(index));
+        }
+    };
+
+    bool hasExtension(const string& path, const string& extension) {
+        return path.size() >= extension.size() &&
+               path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    }
+
+    /**
+     * Checks the block index against the query.
+     * @param predicateFields receives the predicates which have to be evaluated per sample
+     * @return false, if no sample of the block can match
+     */
+    template<typename MinMax>
+    bool mayMatch(int64_t first, int64_t last, const MinMax& minMax, const TelemetryQuery& query, int64_t from,
+                  int64_t to, FieldSelection& predicateFields) {
+        if (last < from || first >= to) {
+            return false;
+        }
+
+        predicateFields.reset();
+        for (const auto& predicate : query._predicates) {
+            double min = minMax(predicate._field, true);
+            double max = minMax(predicate._field, false);
+            if (max < predicate._min || min > predicate._max) {
+                return false;
+            }
+            if (min < predicate._min || max > predicate._max) {
+                predicateFields.set(static_cast<int>(predicate._field));
+            }
+        }
+        return true;
+    }
+
+    template<typename Columns>
+    void scan(const Columns& columns, size_t count, const TelemetryQuery& query, int64_t from, int64_t to,
+              const FieldSelection& predicateFields, TelemetryAggregate& aggregate) {
+        for (size_t i = 0; i < count; i++) {
+            int64_t timestamp = columns.timestamp(i);
+            if (timestamp < from || timestamp >= to) {
+                continue;
+            }
+
+            bool matches = true;
+            for (const auto& predicate : query._predicates) {
+                if (!predicateFields.test(static_cast<int>(predicate._field))) {
+                    continue;
+                }
+                double value = columns.value(predicate._field, i);
+                if (value < predicate._min || value > predicate._max) {
+                    matches = false;
+                    break;
+                }
+            }
+            if (!matches) {
+                continue;
+            }
+
+            aggregate._samples++;
+            for (int f = 0; f < STATUS_FIELD_COUNT; f++) {
+                if (!query._fields.test(f)) {
+                    continue;
+                }
+                double value = columns.value(static_cast<StatusField>(f), i);
+                FieldAggregate& field = aggregate._fields[f];
+                field._count++;
+                field._sum += value;
+                if (value < field._min) {
+                    field._min = value;
+                }
+                if (value > field._max) {
+                    field._max = value;
+                }
+                if (timestamp < field._firstTimestamp) {
+                    field._firstTimestamp = timestamp;
+                    field._first = value;
+                }
+                if (timestamp > field._lastTimestamp) {
+                    field._lastTimestamp = timestamp;
+                    field._last = value;
+                }
+            }
+        }
+    }
+
+    int64_t shift(int64_t value, int64_t origin) {
+        if (value == std::numeric_limits<int64_t>::min() || value == std::numeric_limits<int64_t>::max()) {
+            return value;
+        }
+        return value + origin;
+    }
+}
+
+double tello::FieldAggregate::mean() const {
+    return _count == 0 ? 0.0 : _sum / static_cast<double>(_count);
+}
+
+double tello::FieldAggregate::rate() const {
+    if (_count < 2 || _lastTimestamp <= _firstTimestamp) {
+        return 0.0;
+    }
+    return (_last - _first) * 1000000.0 / static_cast<double>(_lastTimestamp - _firstTimestamp);
+}
+
+void tello::FieldAggregate::merge(const FieldAggregate& other) {
+    if (other._count == 0) {
+        return;
+    }
+    _count += other._count;
+    _sum += other._sum;
+    if (other._min < _min) {
+        _min = other._min;
+    }
+    if (other._max > _max) {
+        _max = other._max;
+    }
+    if (other._firstTimestamp < _firstTimestamp) {
+        _firstTimestamp = other._firstTimestamp;
+        _first = other._first;
+    }
+    if (other._lastTimestamp > _lastTimestamp) {
+        _lastTimestamp = other._lastTimestamp;
+        _last = other._last;
+    }
+}
+
+void tello::TelemetryAggregate::merge(const TelemetryAggregate& other) {
+    _samples += other._samples;
+    for (int f = 0; f < STATUS_FIELD_COUNT; f++) {
+        _fields[f].merge(other._fields[f]);
+    }
+}
+
+tello::TelemetryQueryEngine::TelemetryQueryEngine(unsigned int threads)
+        : _threadpool(std::make_unique<Threadpool>(threads > 0 ? static_cast<int>(threads) : 1)) {}
+
+tello::TelemetryQueryEngine::~TelemetryQueryEngine() = default;
+
+TelemetryQueryResult tello::TelemetryQueryEngine::run(const vector<string>& recordings, const TelemetryQuery& query) {
+    TelemetryQueryResult result;
+
+    vector<Recording> opened;
+    size_t tasks = 0;
+    for (const auto& path : recordings) {
+        Recording recording;
+        recording._path = path;
+        if (hasExtension(path, COLUMNAR_EXTENSION)) {
+            recording._columnar = std::make_unique<TelemetryReader>();
+            if (!recording._columnar->open(path)) {
+                result._failed.push_back(path);
+                continue;
+            }
+            recording._drone = recording._columnar->drone();
+            recording._blocks = recording._columnar->blockCount();
+            recording._origin = recording._blocks > 0 ? recording._columnar->block(0).firstTimestamp() : 0;
+        } else {
+            recording._archive = std::make_unique<TelemetryArchiveReader>();
+            if (!recording._archive->open(path)) {
+                result._failed.push_back(path);
+                continue;
+            }
+            recording._drone = recording._archive->drone();
+            recording._blocks = recording._archive->blockCount();
+            recording._origin = recording._blocks > 0 ? recording._archive->index(0)._firstTimestamp : 0;
+        }
+        recording._firstTask = tasks;
+        tasks += recording._blocks;
+        opened.push_back(std::move(recording));
+    }
+
+    vector<TelemetryAggregate> partials(tasks);
+    std::atomic<unsigned long long> scanned{0};
+    std::atomic<unsigned long long> skipped{0};
+    std::atomic<unsigned long long> samples{0};
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    size_t remaining = tasks;
+
+    for (const auto& recording : opened) {
+        int64_t from = query._relativeTime ? shift(query._from, recording._origin) : query._from;
+        int64_t to = query._relativeTime ? shift(query._to, recording._origin) : query._to;
+
+        for (size_t block = 0; block < recording._blocks; block++) {
+            TelemetryAggregate& partial = partials[recording._firstTask + block];
+            const Recording* source = &recording;
+
+            _threadpool->push([&, source, block, from, to](int) {
+                FieldSelection predicateFields;
+                bool matched;
+                if (source->_archive != nullptr) {
+                    const auto& index = source->_archive->index(block);
+                    matched = mayMatch(index._firstTimestamp, index._lastTimestamp,
+                                       [&index](StatusField field, bool min) {
+                                           return min ? index._min[static_cast<int>(field)]
+                                                      : index._max[static_cast<int>(field)];
+                                       }, query, from, to, predicateFields);
+                    TelemetryColumns columns;
+                    if (matched && source->_archive->decode(block, columns, query._fields | predicateFields)) {
+                        scan(ArchiveColumns{columns}, columns._count, query, from, to, predicateFields, partial);
+                        samples += columns._count;
+                    }
+                } else {
+                    TelemetryBlock columnarBlock = source->_columnar->block(block);
+                    matched = columnarBlock.count() > 0 &&
+                              mayMatch(columnarBlock.firstTimestamp(), columnarBlock.lastTimestamp(),
+                                       [&columnarBlock](StatusField field, bool min) {
+                                           return min ? columnarBlock.min(field) : columnarBlock.max(field);
+                                       }, query, from, to, predicateFields);
+                    if (matched) {
+                        scan(ColumnarColumns{columnarBlock}, columnarBlock.count(), query, from, to,
+                             predicateFields, partial);
+                        samples += columnarBlock.count();
+                    }
+                }
+                (matched ? scanned : skipped)++;
+
+                std::lock_guard<std::mutex> lock(doneMutex);
+                if (--remaining == 0) {
+                    doneCondition.notify_one();
+                }
+            });
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(doneMutex);
+        doneCondition.wait(lock, [&remaining] { return remaining == 0; });
+    }
+
+    for (const auto& recording : opened) {
+        RecordingAggregate aggregate{recording._path, recording._drone, {}};
+        for (size_t block = 0; block < recording._blocks; block++) {
+            aggregate._aggregate.merge(partials[recording._firstTask + block]);
+        }
+        result._drones[recording._drone].merge(aggregate._aggregate);
+        result._recordings.push_back(std::move(aggregate));
+    }
+
+    result._blocksScanned = scanned;
+    result._blocksSkipped = skipped;
+    result._samplesScanned = samples;
+    return result;
+}
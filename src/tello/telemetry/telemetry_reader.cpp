@@ -0,0 +1,125 @@
+#include <tello/telemetry/telemetry_reader.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "columnar_format.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::StatusField;
+using tello::StatusSample;
+using tello::TelemetryBlock;
+using namespace tello::telemetry;
+
+tello::TelemetryBlock::TelemetryBlock(const char* block, unsigned int capacity) : _block(block), _capacity(capacity) {}
+
+unsigned int tello::TelemetryBlock::count() const {
+    unsigned int count = reinterpret_cast<const ColumnarBlockHeader*>(_block)->_count;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return count;
+}
+
+int64_t tello::TelemetryBlock::firstTimestamp() const {
+    return reinterpret_cast<const ColumnarBlockHeader*>(_block)->_firstTimestamp;
+}
+
+int64_t tello::TelemetryBlock::lastTimestamp() const {
+    return reinterpret_cast<const ColumnarBlockHeader*>(_block)->_lastTimestamp;
+}
+
+double tello::TelemetryBlock::min(StatusField field) const {
+    return reinterpret_cast<const ColumnarBlockHeader*>(_block)->_statistics[static_cast<int>(field)]._min;
+}
+
+double tello::TelemetryBlock::max(StatusField field) const {
+    return reinterpret_cast<const ColumnarBlockHeader*>(_block)->_statistics[static_cast<int>(field)]._max;
+}
+
+const int64_t* tello::TelemetryBlock::timestamps() const {
+    return reinterpret_cast<const int64_t*>(_block + columnarTimestampOffset());
+}
+
+const int32_t* tello::TelemetryBlock::intColumn(StatusField field) const {
+    if (isFloatField(field)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const int32_t*>(_block + columnarColumnOffset(_capacity, field));
+}
+
+const float* tello::TelemetryBlock::floatColumn(StatusField field) const {
+    if (!isFloatField(field)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const float*>(_block + columnarColumnOffset(_capacity, field));
+}
+
+double tello::TelemetryBlock::value(StatusField field, unsigned int index) const {
+    return isFloatField(field) ? floatColumn(field)[index] : intColumn(field)[index];
+}
+
+StatusSample tello::TelemetryBlock::sample(unsigned int index) const {
+    StatusSample sample;
+    for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+        auto field = static_cast<StatusField>(i);
+        sample.setBits(field, reinterpret_cast<const uint32_t*>(_block + columnarColumnOffset(_capacity, field))[index]);
+    }
+    return sample;
+}
+
+tello::TelemetryReader::TelemetryReader() : _map(MemoryMapFactory::build()), _blockCount(0) {}
+
+tello::TelemetryReader::~TelemetryReader() = default;
+
+bool tello::TelemetryReader::open(const string& path) {
+    close();
+    if (!_map->open(path, 0, false)) {
+        LoggerInterface::error(LoggerType::STATUS, string("Cannot map telemetry file {}"), path);
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const ColumnarFileHeader*>(_map->data());
+    if (_map->size() < columnarFileHeaderSize() ||
+        std::memcmp(header->_magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) != 0 ||
+        header->_version != TELEMETRY_COLUMNAR_VERSION || header->_fieldCount != STATUS_FIELD_COUNT ||
+        header->_blockSize != columnarBlockSize(header->_blockCapacity)) {
+        LoggerInterface::error(LoggerType::STATUS, string("{} is not a columnar telemetry file"), path);
+        close();
+        return false;
+    }
+
+    // A file which is still recorded may announce a block which is not mapped yet.
+    size_t mappedBlocks = (_map->size() - columnarFileHeaderSize()) / header->_blockSize;
+    _blockCount = std::min<size_t>(header->_blockCount, mappedBlocks);
+    return true;
+}
+
+void tello::TelemetryReader::close() {
+    _map->close();
+    _blockCount = 0;
+}
+
+ip_address tello::TelemetryReader::drone() const {
+    return static_cast<ip_address>(reinterpret_cast<const ColumnarFileHeader*>(_map->data())->_drone);
+}
+
+size_t tello::TelemetryReader::blockCount() const {
+    return _blockCount;
+}
+
+TelemetryBlock tello::TelemetryReader::block(size_t index) const {
+    const auto* header = reinterpret_cast<const ColumnarFileHeader*>(_map->data());
+    return TelemetryBlock{_map->data() + columnarFileHeaderSize() + index * header->_blockSize,
+                          header->_blockCapacity};
+}
+
+unsigned long long tello::TelemetryReader::sampleCount() const {
+    unsigned long long count = 0;
+    for (size_t i = 0; i < _blockCount; i++) {
+        count += block(i).count();
+    }
+    return count;
+}
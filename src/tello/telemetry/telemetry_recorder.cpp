@@ -0,0 +1,111 @@
+#include <tello/telemetry/telemetry_recorder.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "columnar_writer.hpp"
+#include <chrono>
+
+#define TELEMETRY_WRITE_INTERVAL_MS 100
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::telemetry::ColumnarWriter;
+
+tello::TelemetryRecorder::TelemetryRecorder(string directory, unsigned int blockCapacity)
+        : _directory(std::move(directory)),
+          _blockCapacity(blockCapacity),
+          _pending(),
+          _pendingMutex(),
+          _pendingCondition(),
+          _running(true),
+          _recorded(0),
+          _dropped(0),
+          _writers(),
+          _worker() {
+    _pending.reserve(TELEMETRY_QUEUE_CAPACITY);
+    _worker = thread(static_cast<void (TelemetryRecorder::*)()>(&TelemetryRecorder::write), this);
+}
+
+tello::TelemetryRecorder::~TelemetryRecorder() {
+    stop();
+}
+
+bool tello::TelemetryRecorder::record(ip_address drone, int64_t timestamp, const StatusSample& sample) {
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    if (!_running || _pending.size() >= TELEMETRY_QUEUE_CAPACITY) {
+        _dropped++;
+        return false;
+    }
+    _pending.push_back(PendingSample{drone, timestamp, sample});
+    return true;
+}
+
+void tello::TelemetryRecorder::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _pendingCondition.notify_one();
+    _worker.join();
+    _writers.clear();
+}
+
+unsigned long long tello::TelemetryRecorder::recorded() const {
+    return _recorded;
+}
+
+unsigned long long tello::TelemetryRecorder::dropped() const {
+    return _dropped;
+}
+
+string tello::TelemetryRecorder::path(const string& directory, ip_address drone) {
+    return directory + "/telemetry_" + std::to_string((drone >> 24) & 0xFF) + "." +
+           std::to_string((drone >> 16) & 0xFF) + "." + std::to_string((drone >> 8) & 0xFF) + "." +
+           std::to_string(drone & 0xFF) + ".tcol";
+}
+
+void tello::TelemetryRecorder::write() {
+    vector<PendingSample> samples;
+    samples.reserve(TELEMETRY_QUEUE_CAPACITY);
+    bool running = true;
+
+    while (running) {
+        {
+            std::unique_lock<std::mutex> lock(_pendingMutex);
+            _pendingCondition.wait_for(lock, std::chrono::milliseconds(TELEMETRY_WRITE_INTERVAL_MS));
+            // Swap instead of copy, the listener keeps a preallocated buffer.
+            samples.swap(_pending);
+            running = _running;
+        }
+
+        write(samples);
+        samples.clear();
+    }
+
+    for (auto& writer : _writers) {
+        if (writer.second != nullptr) {
+            writer.second->flush();
+        }
+    }
+}
+
+void tello::TelemetryRecorder::write(const vector<PendingSample>& samples) {
+    for (const auto& pending : samples) {
+        auto writer = _writers.find(pending._drone);
+        if (writer == _writers.end()) {
+            auto columnarWriter = std::make_unique<ColumnarWriter>(pending._drone, _blockCapacity);
+            if (!columnarWriter->open(path(_directory, pending._drone))) {
+                // Remember the failure, so the file is not reopened for every sample.
+                columnarWriter = nullptr;
+            }
+            writer = _writers.emplace(pending._drone, std::move(columnarWriter)).first;
+        }
+
+        if (writer->second != nullptr && writer->second->append(pending._timestamp, pending._sample)) {
+            _recorded++;
+        } else {
+            _dropped++;
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#include <tello/telemetry/telemetry_table.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "telemetry_table_format.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include <cstring>
+#include <thread>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::TelemetrySnapshot;
+using tello::telemetry::TelemetryTableHeader;
+using tello::telemetry::TelemetryTableSlot;
+
+namespace {
+
+    TelemetryTableHeader* headerOf(char* table) {
+        return reinterpret_cast<TelemetryTableHeader*>(table);
+    }
+
+    TelemetryTableSlot* slotsOf(char* table) {
+        return reinterpret_cast<TelemetryTableSlot*>(table + tello::telemetry::telemetryTableHeaderSize());
+    }
+}
+
+tello::TelemetryTable::TelemetryTable(const string& path, uint32_t slots)
+        : _map(MemoryMapFactory::build()), _slots(slots > 0 ? slots : 1) {
+    if (!_map->open(path, telemetry::telemetryTableSize(_slots), true)) {
+        LoggerInterface::error(LoggerType::STATUS, string("Cannot map telemetry table {}"), path);
+        _map->close();
+        return;
+    }
+
+    // a new session, readers of an old one see no drones
+    TelemetryTableHeader* header = headerOf(_map->data());
+    std::memset(_map->data(), 0, telemetry::telemetryTableSize(_slots));
+    header->_version = TELEMETRY_TABLE_VERSION;
+    header->_slotCount = _slots;
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->_magic, telemetry::TELEMETRY_TABLE_MAGIC, sizeof(telemetry::TELEMETRY_TABLE_MAGIC));
+}
+
+tello::TelemetryTable::~TelemetryTable() {
+    _map->close();
+}
+
+bool tello::TelemetryTable::update(ip_address drone, int64_t timestamp, const StatusSample& sample) {
+    if (_map->data() == nullptr) {
+        return false;
+    }
+
+    TelemetryTableHeader* header = headerOf(_map->data());
+    TelemetryTableSlot* slots = slotsOf(_map->data());
+    uint64_t drones = header->_drones.load(std::memory_order_relaxed);
+    uint64_t index = 0;
+    while (index < drones && slots[index]._drone != drone) {
+        index++;
+    }
+    if (index == _slots) {
+        return false;
+    }
+
+    TelemetryTableSlot& slot = slots[index];
+    uint64_t version = slot._version.load(std::memory_order_relaxed);
+    slot._version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot._drone = drone;
+    slot._timestamp = timestamp;
+    slot._sample = sample;
+    slot._version.store(version + 2, std::memory_order_release);
+
+    if (index == drones) {
+        header->_drones.store(drones + 1, std::memory_order_release);
+    }
+    return true;
+}
+
+tello::TelemetryTableReader::TelemetryTableReader() : _map(MemoryMapFactory::build()) {
+}
+
+tello::TelemetryTableReader::~TelemetryTableReader() {
+    close();
+}
+
+bool tello::TelemetryTableReader::open(const string& path) {
+    if (!_map->open(path, 0, false)) {
+        return false;
+    }
+
+    const TelemetryTableHeader* header = headerOf(_map->data());
+    bool valid = _map->size() >= telemetry::telemetryTableHeaderSize() &&
+                 std::memcmp(header->_magic, telemetry::TELEMETRY_TABLE_MAGIC,
+                             sizeof(telemetry::TELEMETRY_TABLE_MAGIC)) == 0 &&
+                 header->_version == TELEMETRY_TABLE_VERSION &&
+                 _map->size() >= telemetry::telemetryTableSize(header->_slotCount);
+    if (!valid) {
+        _map->close();
+        return false;
+    }
+    return true;
+}
+
+void tello::TelemetryTableReader::close() {
+    _map->close();
+}
+
+vector<ip_address> tello::TelemetryTableReader::drones() const {
+    vector<ip_address> drones;
+    if (_map->data() == nullptr) {
+        return drones;
+    }
+
+    uint64_t count = headerOf(_map->data())->_drones.load(std::memory_order_acquire);
+    const TelemetryTableSlot* slots = slotsOf(_map->data());
+    for (uint64_t i = 0; i < count; i++) {
+        drones.push_back(static_cast<ip_address>(slots[i]._drone));
+    }
+    return drones;
+}
+
+optional<TelemetrySnapshot> tello::TelemetryTableReader::read(ip_address drone) const {
+    if (_map->data() == nullptr) {
+        return std::nullopt;
+    }
+
+    uint64_t count = headerOf(_map->data())->_drones.load(std::memory_order_acquire);
+    const TelemetryTableSlot* slots = slotsOf(_map->data());
+    for (uint64_t i = 0; i < count; i++) {
+        const TelemetryTableSlot& slot = slots[i];
+        if (slot._drone != drone) {
+            continue;
+        }
+
+        // the status listener only holds the slot for a copy of the sample, retrying is cheap
+        TelemetrySnapshot snapshot{};
+        while (true) {
+            uint64_t before = slot._version.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                snapshot._drone = static_cast<ip_address>(slot._drone);
+                snapshot._timestamp = slot._timestamp;
+                std::memcpy(&snapshot._sample, &slot._sample, sizeof(StatusSample));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot._version.load(std::memory_order_relaxed) == before) {
+                    snapshot._updates = before / 2;
+                    return snapshot;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+    return std::nullopt;
+}
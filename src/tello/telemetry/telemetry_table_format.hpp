@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <tello/telemetry/status_sample.hpp>
+
+#define TELEMETRY_TABLE_VERSION 1
+#define TELEMETRY_TABLE_ALIGNMENT 64
+
+namespace tello::telemetry {
+
+    constexpr char TELEMETRY_TABLE_MAGIC[8] = {'T', 'L', 'M', 'T', 'A', 'B', '0', '1'};
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the table is shared between processes");
+
+    /**
+     * Layout of the shared telemetry table:
+     * | header | slot 0 | slot 1 | ... |
+     * Every slot starts on its own cache line and holds the latest sample of one drone.
+     * The version of a slot is odd while the status listener writes it (seqlock).
+     */
+    struct TelemetryTableHeader {
+        char _magic[8];
+        uint32_t _version;
+        uint32_t _slotCount;
+        std::atomic<uint64_t> _drones;
+    };
+
+    struct alignas(TELEMETRY_TABLE_ALIGNMENT) TelemetryTableSlot {
+        std::atomic<uint64_t> _version;
+        uint64_t _drone;
+        int64_t _timestamp;
+        StatusSample _sample;
+    };
+
+    constexpr size_t alignTable(size_t size) {
+        return (size + TELEMETRY_TABLE_ALIGNMENT - 1) & ~static_cast<size_t>(TELEMETRY_TABLE_ALIGNMENT - 1);
+    }
+
+    constexpr size_t telemetryTableHeaderSize() {
+        return alignTable(sizeof(TelemetryTableHeader));
+    }
+
+    constexpr size_t telemetryTableSize(uint32_t slotCount) {
+        return telemetryTableHeaderSize() + slotCount * sizeof(TelemetryTableSlot);
+    }
+}
@@ -1,5 +1,8 @@
 #include <tello/tello.hpp>
 #include "connection/network.hpp"
+#include "thread/subscriber_list.hpp"
+#include "video/video_demand.hpp"
+#include <tello/video/video_recorder.hpp>
 
 #include "command/command_command.hpp"
 #include "command/takeoff_command.hpp"
@@ -28,31 +31,174 @@ using tello::Response;
 using tello::ConnectionData;
 using tello::LoggerInterface;
 using tello::Status;
+using tello::StatusSubscriber;
+using tello::FrameHandle;
+using tello::threading::SubscriberList;
+using tello::video::VideoDemand;
 
 using namespace tello::command;
 
+namespace {
+
+    struct VideoPriming {
+        vector<FrameHandle> _gop;
+        uint64_t _lastPrimed;
+    };
+
+    /**
+     * Passes the cached frames before the first live frame, live frames already cached are skipped
+     */
+    tello::video_handler primed(tello::video_handler videoHandler, vector<FrameHandle>&& gop) {
+        uint64_t lastPrimed = gop.back().info()._sequence;
+        auto priming = std::make_shared<VideoPriming>(VideoPriming{std::move(gop), lastPrimed});
+        return [videoHandler = std::move(videoHandler), priming](const VideoResponse& frame) {
+            if (!priming->_gop.empty()) {
+                for (const FrameHandle& cached : priming->_gop) {
+                    videoHandler(VideoResponse{cached});
+                }
+                priming->_gop.clear();
+            }
+            if (frame.info()._sequence > priming->_lastPrimed) {
+                videoHandler(frame);
+            }
+        };
+    }
+}
+
 unordered_map<ip_address, const tello::Tello*> tello::Tello::_telloMapping;
 std::shared_mutex tello::Tello::_telloMappingMutex;
 
 tello::Tello::Tello(ip_address telloIp) : _clientaddr(mapToNetworkData(telloIp)),
-                                          _statusHandler(nullptr) {
+                                          _statusSubscribers(std::make_shared<SubscriberList<StatusSubscriber>>()),
+                                          _videoSubscribers(std::make_shared<SubscriberList<video_handler>>()),
+                                          _nalUnitSubscribers(std::make_shared<SubscriberList<nal_unit_handler>>()),
+                                          _nalUnitLatency(std::make_shared<LatencyHistogram>()),
+                                          _videoQueue(std::make_shared<VideoQueue>()),
+                                          _statusQueue(std::make_shared<StatusQueue>()),
+                                          _gopCache(std::make_shared<GopCache>(Network::gopCacheFrames(), GopCacheMode::DISABLED)),
+                                          _videoHealth(std::make_shared<VideoHealth>()),
+                                          _videoDemand(std::make_shared<VideoDemand>([this](bool streamon) {
+                                              Response response = streamon ? this->streamon().get()
+                                                                           : this->streamoff().get();
+                                              return response.status() == Status::OK;
+                                          })),
+                                          _statusHandlerSubscription(), _videoHandlerSubscription() {
+    auto demandChanged = [videoDemand = _videoDemand](int delta) {
+        videoDemand->changed(delta);
+    };
+    _videoSubscribers->setChangeListener(demandChanged);
+    _nalUnitSubscribers->setChangeListener(demandChanged);
+
     _telloMappingMutex.lock();
     _telloMapping[telloIp] = this;
     _telloMappingMutex.unlock();
 }
 
 tello::Tello::~Tello() {
+    _videoDemand->disable();
     _telloMappingMutex.lock();
     _telloMapping.erase(_clientaddr._ip);
     _telloMappingMutex.unlock();
 }
 
-void tello::Tello::setStatusHandler(status_handler statusHandler) {
-    this->_statusHandler = statusHandler;
+void tello::Tello::setStatusHandler(status_handler statusHandler, const StatusFilter& statusFilter) {
+    _statusHandlerSubscription.unsubscribe();
+    if (statusHandler != nullptr) {
+        _statusHandlerSubscription = subscribeStatus(std::move(statusHandler), statusFilter);
+    }
 }
 
 void tello::Tello::setVideoHandler(video_handler videoHandler) {
-    this->_videoHandler = videoHandler;
+    _videoHandlerSubscription.unsubscribe();
+    if (videoHandler != nullptr) {
+        _videoHandlerSubscription = subscribeVideo(std::move(videoHandler));
+    }
+}
+
+tello::Subscription tello::Tello::subscribeStatus(status_handler statusHandler, const StatusFilter& statusFilter) {
+    uint64_t id = _statusSubscribers->add(StatusSubscriber{std::move(statusHandler), statusFilter});
+    return Subscription{_statusSubscribers, id};
+}
+
+tello::Subscription tello::Tello::subscribeVideo(video_handler videoHandler, bool primeWithGop) {
+    if (!primeWithGop) {
+        uint64_t id = _videoSubscribers->add(std::move(videoHandler));
+        return Subscription{_videoSubscribers, id};
+    }
+
+    // frames cached later are delivered live, the subscriber has to be added before
+    _gopCache->require(GopCacheMode::GOP);
+    uint64_t id = 0;
+    _gopCache->gop([this, &videoHandler, &id](vector<FrameHandle>&& gop) {
+        id = _videoSubscribers->add(gop.empty() ? std::move(videoHandler)
+                                                : primed(std::move(videoHandler), std::move(gop)));
+    });
+    return Subscription{_videoSubscribers, id};
+}
+
+FrameHandle tello::Tello::videoSnapshot() const {
+    _gopCache->require(GopCacheMode::KEYFRAME);
+    return _gopCache->snapshot();
+}
+
+tello::Subscription tello::Tello::subscribeNalUnits(nal_unit_handler nalUnitHandler) {
+    uint64_t id = _nalUnitSubscribers->add(std::move(nalUnitHandler));
+    return Subscription{_nalUnitSubscribers, id};
+}
+
+const tello::LatencyHistogram& tello::Tello::nalUnitLatency() const {
+    return *_nalUnitLatency;
+}
+
+void tello::Tello::setVideoQueue(size_t capacity, VideoDropPolicy policy) {
+    _videoQueue->configure(capacity, policy);
+}
+
+tello::VideoQueueStatistics tello::Tello::videoQueueStatistics() const {
+    return _videoQueue->statistics();
+}
+
+void tello::Tello::setVideoOnDemand(bool enabled, std::chrono::milliseconds streamoffDelay) {
+    if (enabled) {
+        _videoDemand->enable(streamoffDelay);
+    } else {
+        _videoDemand->disable();
+    }
+}
+
+void tello::Tello::setStatusQueue(size_t capacity, StatusDropPolicy policy) {
+    _statusQueue->configure(capacity, policy);
+}
+
+tello::StatusQueueStatistics tello::Tello::statusQueueStatistics() const {
+    return _statusQueue->statistics();
+}
+
+void tello::Tello::setExecutor(shared_ptr<Executor> executor) {
+    std::atomic_store(&_executor, std::move(executor));
+}
+
+tello::VideoHealthStatistics tello::Tello::videoHealth() const {
+    return _videoHealth->statistics();
+}
+
+void tello::Tello::setTelemetryRecorder(shared_ptr<TelemetryRecorder> telemetryRecorder) {
+    std::atomic_store(&_telemetryRecorder, std::move(telemetryRecorder));
+}
+
+void tello::Tello::setTelemetryTable(shared_ptr<TelemetryTable> telemetryTable) {
+    std::atomic_store(&_telemetryTable, std::move(telemetryTable));
+}
+
+void tello::Tello::setVideoRecorder(shared_ptr<VideoRecorder> videoRecorder) {
+    if (videoRecorder != nullptr) {
+        videoRecorder->limit(Network::recorderFrames());
+    }
+    std::atomic_store(&_videoRecorder, std::move(videoRecorder));
+}
+
+void tello::Tello::setVideoRing(shared_ptr<VideoRingPublisher> videoRing) {
+    std::atomic_store(&_videoRing, std::move(videoRing));
 }
 
 /////////////////////////////////////////////////////////////
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <tello/subscription.hpp>
+
+#define SUBSCRIBER_SLOTS 64
+#define SUBSCRIBER_NO_SLOT SUBSCRIBER_SLOTS
+
+using std::shared_ptr;
+using std::vector;
+
+namespace tello::threading {
+
+    /**
+     * Subscriber list with lock-free dispatch (read-copy-update).
+     *
+     * Writers copy the current snapshot, modify the copy and publish it with an atomic pointer swap.
+     * Readers announce themselves in the counter of the current epoch parity. A writer publishes the
+     * new snapshot, flips the epoch and retires the replaced one. The retired snapshot is deleted once
+     * both parity counters have been seen at zero after its retirement: a reader still holding it entered
+     * before the swap and stays counted in one of them until it leaves. New readers only enter the current
+     * parity, so the other one drains and the current one drains after the next flip (grace period).
+     * Writers never wait for readers, so a subscriber may even unsubscribe from inside its own handler.
+     *
+     * Every subscriber gets one of SUBSCRIBER_SLOTS slots, which stays the same while it is subscribed.
+     * A slot identifies the subscriber in a bit mask, e.g. of the subscribers that accepted a queued update.
+     * Freed slots are reused round-robin, SUBSCRIBER_NO_SLOT is given when all slots are taken.
+     */
+    template<typename Subscriber>
+    class SubscriberList : public SubscriptionSource {
+    public:
+        /**
+         * Gets +1 for an added and -1 for a removed subscriber, called by the writer
+         */
+        using change_listener = std::function<void(int delta)>;
+
+        SubscriberList() : _current(new Snapshot()), _epoch(0), _readers{0, 0}, _nextId(1), _nextSlot(0),
+                           _writerMutex(), _retired(), _changeListener() {
+        }
+
+        SubscriberList(const SubscriberList&) = delete;
+        SubscriberList& operator=(const SubscriberList&) = delete;
+
+        ~SubscriberList() override {
+            delete _current.load();
+            for (auto& retired : _retired) {
+                delete retired._snapshot;
+            }
+        }
+
+        uint64_t add(Subscriber subscriber) {
+            std::lock_guard<std::mutex> lock(_writerMutex);
+            Snapshot* old = _current.load();
+            auto* next = new Snapshot(*old);
+
+            uint64_t id = _nextId++;
+            next->push_back(std::make_shared<Entry>(Entry{id, freeSlot(*old), std::move(subscriber)}));
+            publish(old, next);
+            if (_changeListener) {
+                _changeListener(1);
+            }
+            return id;
+        }
+
+        void unsubscribe(uint64_t id) override {
+            std::lock_guard<std::mutex> lock(_writerMutex);
+            Snapshot* old = _current.load();
+            auto* next = new Snapshot();
+            next->reserve(old->size());
+            for (const auto& entry : *old) {
+                if (entry->_id != id) {
+                    next->push_back(entry);
+                }
+            }
+
+            if (next->size() == old->size()) {
+                delete next;
+                return;
+            }
+            publish(old, next);
+            if (_changeListener) {
+                _changeListener(-1);
+            }
+        }
+
+        void setChangeListener(change_listener changeListener) {
+            std::lock_guard<std::mutex> lock(_writerMutex);
+            _changeListener = std::move(changeListener);
+        }
+
+        /**
+         * Calls 'function' for every subscriber of the current snapshot without taking a lock.
+         */
+        template<typename Function>
+        void forEach(Function&& function) {
+            forEachSlot([&function](size_t, Subscriber& subscriber) {
+                function(subscriber);
+            });
+        }
+
+        /**
+         * Like 'forEach', 'function' gets the slot and the subscriber.
+         */
+        template<typename Function>
+        void forEachSlot(Function&& function) {
+            std::atomic<int>& readers = enter();
+            const Snapshot* snapshot = _current.load(std::memory_order_seq_cst);
+            for (const auto& entry : *snapshot) {
+                function(entry->_slot, entry->_subscriber);
+            }
+            readers.fetch_sub(1, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool empty() const {
+            return _current.load(std::memory_order_acquire)->empty();
+        }
+
+    private:
+        struct Entry {
+            uint64_t _id;
+            size_t _slot;
+            Subscriber _subscriber;
+        };
+
+        using Snapshot = vector<shared_ptr<Entry>>;
+
+        struct Retired {
+            Snapshot* _snapshot;
+            bool _drained[2];
+        };
+
+        std::atomic<Snapshot*> _current;
+        std::atomic<uint64_t> _epoch;
+        std::atomic<int> _readers[2];
+        uint64_t _nextId;
+        size_t _nextSlot;
+        std::mutex _writerMutex;
+        vector<Retired> _retired;
+        change_listener _changeListener;
+
+        std::atomic<int>& enter() {
+            while (true) {
+                uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+                std::atomic<int>& readers = _readers[epoch & 1];
+                readers.fetch_add(1, std::memory_order_seq_cst);
+                if (_epoch.load(std::memory_order_seq_cst) == epoch) {
+                    return readers;
+                }
+                readers.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        size_t freeSlot(const Snapshot& snapshot) {
+            uint64_t used = 0;
+            for (const auto& entry : snapshot) {
+                if (entry->_slot != SUBSCRIBER_NO_SLOT) {
+                    used |= 1ULL << entry->_slot;
+                }
+            }
+            // round-robin, an update still queued for an unsubscribed slot rarely meets its successor
+            for (size_t i = 0; i < SUBSCRIBER_SLOTS; i++) {
+                size_t slot = (_nextSlot + i) % SUBSCRIBER_SLOTS;
+                if ((used & (1ULL << slot)) == 0) {
+                    _nextSlot = (slot + 1) % SUBSCRIBER_SLOTS;
+                    return slot;
+                }
+            }
+            return SUBSCRIBER_NO_SLOT;
+        }
+
+        void publish(Snapshot* old, Snapshot* next) {
+            _current.store(next, std::memory_order_seq_cst);
+            _epoch.fetch_add(1, std::memory_order_seq_cst);
+            _retired.push_back(Retired{old, {false, false}});
+            reclaim();
+        }
+
+        void reclaim() {
+            bool drained[2] = {
+                    _readers[0].load(std::memory_order_seq_cst) == 0,
+                    _readers[1].load(std::memory_order_seq_cst) == 0
+            };
+            auto retired = _retired.begin();
+            while (retired != _retired.end()) {
+                retired->_drained[0] = retired->_drained[0] || drained[0];
+                retired->_drained[1] = retired->_drained[1] || drained[1];
+                if (retired->_drained[0] && retired->_drained[1]) {
+                    delete retired->_snapshot;
+                    retired = _retired.erase(retired);
+                } else {
+                    ++retired;
+                }
+            }
+        }
+    };
+}
@@ -1,15 +1,34 @@
 #include "thread_pool.hpp"
 #include <tello/native/network_interface.hpp>
 #include "thread_pool_impl.hpp"
+#include <algorithm>
 
 using tello::NetworkResponse;
 
 using tello::threading::ThreadPoolImpl;
 
-tello::threading::Threadpool::Threadpool() : _impl(new ThreadPoolImpl()) {}
+tello::threading::Threadpool::Threadpool() : _impl(new ThreadPoolImpl(defaultThreads())) {}
 
-void tello::threading::Threadpool::push(std::function<void(int)>&& function) {
-    _impl->push(function);
+tello::threading::Threadpool::Threadpool(int threads) : _impl(new ThreadPoolImpl(threads)) {}
+
+void tello::threading::Threadpool::push(Task&& task) {
+    _impl->push(std::move(task));
+}
+
+void tello::threading::Threadpool::resize(int threads) {
+    _impl->resize(threads > 0 ? threads : 1);
+}
+
+int tello::threading::Threadpool::size() const {
+    return _impl->size();
+}
+
+void tello::threading::Threadpool::setWorkerSetup(worker_setup setup) {
+    _impl->setWorkerSetup(std::move(setup));
+}
+
+void tello::threading::Threadpool::setWakeupLatency(LatencyHistogram* wakeupLatency) {
+    _impl->setWakeupLatency(wakeupLatency);
 }
 
 void tello::threading::Threadpool::stop() {
@@ -17,3 +36,8 @@ void tello::threading::Threadpool::stop() {
 }
 
 tello::threading::Threadpool::~Threadpool() = default;
+
+int tello::threading::Threadpool::defaultThreads() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return static_cast<int>(std::min(std::max(cores, 1u), (unsigned int) MAX_DEFAULT_THREADS));
+}
@@ -3,13 +3,18 @@
 #include <functional>
 #include <memory>
 #include <shared_mutex>
+#include <thread>
 #include <unordered_map>
+#include <tello/task.hpp>
+
+#define MAX_DEFAULT_THREADS 4
 
 using ip_address = unsigned long;
 
 namespace tello {
     class NetworkResponse;
     class Tello;
+    class LatencyHistogram;
     enum class LoggerType;
 }
 
@@ -17,15 +22,54 @@ namespace tello::threading {
 
     class ThreadPoolImpl;
 
+    /**
+     * Configures a worker thread, e.g. its CPU and priority
+     */
+    using worker_setup = std::function<void(int worker, std::thread& thread)>;
+
+    /**
+     * Work-stealing pool. Every worker has a deque of its own, an idle worker steals from the others.
+     * Tasks run roughly in push order. Tasks, which have to run in order, are drained by one task,
+     * like the VideoQueue and StatusQueue of a drone.
+     */
     class Threadpool {
     public:
+        /**
+         * One worker per core, at most MAX_DEFAULT_THREADS
+         */
         Threadpool();
+        explicit Threadpool(int threads);
         ~Threadpool();
 
-        void push(std::function<void(int)>&& function);
+        [[nodiscard]] static int defaultThreads();
+
+        /**
+         * A task pushed by a worker is queued on the deque of that worker
+         */
+        void push(Task&& task);
+
+        /**
+         * Adds or removes workers, queued tasks are kept
+         */
+        void resize(int threads);
+        [[nodiscard]] int size() const;
+
+        /**
+         * Applied to the running workers and to every worker started later
+         */
+        void setWorkerSetup(worker_setup setup);
+
+        /**
+         * Records the time from push until a worker starts the task, nullptr stops measuring
+         */
+        void setWakeupLatency(LatencyHistogram* wakeupLatency);
+
+        /**
+         * Waits for the running tasks, queued tasks are discarded
+         */
         void stop();
 
     private:
         std::unique_ptr<ThreadPoolImpl> _impl;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,8 @@
+#include "thread_pool_executor.hpp"
+
+tello::threading::ThreadPoolExecutor::ThreadPoolExecutor(Threadpool& threadpool) : _threadpool(threadpool) {
+}
+
+void tello::threading::ThreadPoolExecutor::post(executor_task&& task) {
+    _threadpool.push(std::move(task));
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <tello/executor.hpp>
+#include "thread_pool.hpp"
+
+namespace tello::threading {
+
+    /**
+     * Default executor, dispatches on the workers of the library
+     */
+    class ThreadPoolExecutor : public Executor {
+    public:
+        explicit ThreadPoolExecutor(Threadpool& threadpool);
+
+        void post(executor_task&& task) override;
+
+    private:
+        Threadpool& _threadpool;
+    };
+}
@@ -0,0 +1,209 @@
+#include "thread_pool_impl.hpp"
+#include <chrono>
+
+namespace {
+
+    /**
+     * Worker and pool of the current thread, pushes of a worker go to its own deque
+     */
+    thread_local const void* currentPool = nullptr;
+    thread_local void* currentWorker = nullptr;
+}
+
+tello::threading::ThreadPoolImpl::ThreadPoolImpl(int threads)
+        : _workersMutex(), _workers(), _nextWorker(0), _pending(0), _sleeping(0), _idleMutex(), _idle(),
+          _workerSetup(), _wakeupLatency(nullptr), _stopped(false) {
+    std::unique_lock<std::shared_mutex> lock(_workersMutex);
+    startWorkers(threads > 0 ? threads : 1);
+}
+
+tello::threading::ThreadPoolImpl::~ThreadPoolImpl() {
+    stop();
+}
+
+void tello::threading::ThreadPoolImpl::push(Task&& task) {
+    int64_t queued = _wakeupLatency.load(std::memory_order_relaxed) != nullptr ? now() : 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(_workersMutex);
+        if (_stopped) {
+            return;
+        }
+
+        Worker* worker = currentPool == this ? static_cast<Worker*>(currentWorker) : nullptr;
+        if (worker == nullptr) {
+            worker = _workers[_nextWorker.fetch_add(1, std::memory_order_relaxed) % _workers.size()].get();
+        }
+        std::lock_guard<std::mutex> workerLock(worker->_mutex);
+        worker->_tasks.push_back(QueuedTask{std::move(task), queued});
+    }
+
+    // pairs with the sleeping worker, which counts itself before it checks '_pending'
+    _pending.fetch_add(1, std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_seq_cst) > 0) {
+        wake(false);
+    }
+}
+
+void tello::threading::ThreadPoolImpl::resize(int threads) {
+    vector<std::unique_ptr<Worker>> removed;
+    {
+        std::unique_lock<std::shared_mutex> lock(_workersMutex);
+        if (_stopped || threads == static_cast<int>(_workers.size())) {
+            return;
+        }
+        if (threads > static_cast<int>(_workers.size())) {
+            startWorkers(threads - static_cast<int>(_workers.size()));
+            return;
+        }
+        while (static_cast<int>(_workers.size()) > threads) {
+            _workers.back()->_stop = true;
+            removed.push_back(std::move(_workers.back()));
+            _workers.pop_back();
+        }
+    }
+
+    wake(true);
+    for (auto& worker : removed) {
+        worker->_thread.join();
+    }
+
+    // tasks left on the removed deques move to the remaining workers
+    std::unique_lock<std::shared_mutex> lock(_workersMutex);
+    size_t next = 0;
+    for (auto& worker : removed) {
+        for (QueuedTask& task : worker->_tasks) {
+            Worker& target = *_workers[next++ % _workers.size()];
+            std::lock_guard<std::mutex> workerLock(target._mutex);
+            target._tasks.push_back(std::move(task));
+        }
+    }
+    lock.unlock();
+    wake(true);
+}
+
+int tello::threading::ThreadPoolImpl::size() {
+    std::shared_lock<std::shared_mutex> lock(_workersMutex);
+    return static_cast<int>(_workers.size());
+}
+
+void tello::threading::ThreadPoolImpl::setWorkerSetup(std::function<void(int, thread&)> setup) {
+    std::unique_lock<std::shared_mutex> lock(_workersMutex);
+    _workerSetup = std::move(setup);
+    if (_workerSetup) {
+        for (auto& worker : _workers) {
+            _workerSetup(worker->_id, worker->_thread);
+        }
+    }
+}
+
+void tello::threading::ThreadPoolImpl::setWakeupLatency(LatencyHistogram* wakeupLatency) {
+    _wakeupLatency.store(wakeupLatency, std::memory_order_relaxed);
+}
+
+void tello::threading::ThreadPoolImpl::stop() {
+    vector<std::unique_ptr<Worker>> stopped;
+    {
+        std::unique_lock<std::shared_mutex> lock(_workersMutex);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+        for (auto& worker : _workers) {
+            worker->_stop = true;
+        }
+        stopped = std::move(_workers);
+        _workers.clear();
+    }
+
+    wake(true);
+    for (auto& worker : stopped) {
+        worker->_thread.join();
+    }
+}
+
+void tello::threading::ThreadPoolImpl::startWorkers(int threads) {
+    for (int i = 0; i < threads; i++) {
+        auto worker = std::make_unique<Worker>();
+        worker->_id = static_cast<int>(_workers.size());
+        worker->_thread = thread(&ThreadPoolImpl::run, this, worker.get());
+        if (_workerSetup) {
+            _workerSetup(worker->_id, worker->_thread);
+        }
+        _workers.push_back(std::move(worker));
+    }
+}
+
+void tello::threading::ThreadPoolImpl::run(Worker* worker) {
+    currentPool = this;
+    currentWorker = worker;
+
+    while (!worker->_stop.load(std::memory_order_acquire)) {
+        optional<QueuedTask> task = take(worker);
+        if (task) {
+            _pending.fetch_sub(1, std::memory_order_relaxed);
+            LatencyHistogram* wakeupLatency = _wakeupLatency.load(std::memory_order_relaxed);
+            if (wakeupLatency != nullptr && task->_queued != 0) {
+                wakeupLatency->record(now() - task->_queued);
+            }
+            task->_task(worker->_id);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_idleMutex);
+        _sleeping.fetch_add(1, std::memory_order_seq_cst);
+        _idle.wait(lock, [this, worker]() {
+            return _pending.load(std::memory_order_seq_cst) > 0 || worker->_stop.load(std::memory_order_acquire);
+        });
+        _sleeping.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    currentPool = nullptr;
+    currentWorker = nullptr;
+}
+
+optional<tello::threading::ThreadPoolImpl::QueuedTask> tello::threading::ThreadPoolImpl::take(Worker* worker) {
+    optional<QueuedTask> task = popFront(*worker);
+    if (task) {
+        return task;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(_workersMutex);
+    size_t count = _workers.size();
+    size_t start = static_cast<size_t>(worker->_id) + 1;
+    for (size_t i = 0; i < count; i++) {
+        Worker& victim = *_workers[(start + i) % count];
+        if (&victim != worker) {
+            task = popFront(victim);
+            if (task) {
+                return task;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+optional<tello::threading::ThreadPoolImpl::QueuedTask> tello::threading::ThreadPoolImpl::popFront(Worker& worker) {
+    std::lock_guard<std::mutex> lock(worker._mutex);
+    if (worker._tasks.empty()) {
+        return std::nullopt;
+    }
+    optional<QueuedTask> task{std::move(worker._tasks.front())};
+    worker._tasks.pop_front();
+    return task;
+}
+
+void tello::threading::ThreadPoolImpl::wake(bool all) {
+    {
+        std::lock_guard<std::mutex> lock(_idleMutex);
+    }
+    if (all) {
+        _idle.notify_all();
+    } else {
+        _idle.notify_one();
+    }
+}
+
+int64_t tello::threading::ThreadPoolImpl::now() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
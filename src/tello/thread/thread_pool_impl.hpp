@@ -1,34 +1,79 @@
 #pragma once
 
-#include <ctpl_stl.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <tello/task.hpp>
+#include <tello/latency_histogram.hpp>
 
-#define THREADS 1
+using std::optional;
+using std::thread;
+using std::vector;
 
 namespace tello::threading {
 
     class ThreadPoolImpl {
     public:
-        ThreadPoolImpl() : _pool(THREADS) {}
+        explicit ThreadPoolImpl(int threads);
         ThreadPoolImpl(const ThreadPoolImpl&) = delete;
         ThreadPoolImpl& operator=(const ThreadPoolImpl&) = delete;
         ThreadPoolImpl(ThreadPoolImpl&&) = delete;
         ThreadPoolImpl& operator=(ThreadPoolImpl&&) = delete;
+        ~ThreadPoolImpl();
 
-        template<typename F, typename... Rest>
-        auto push(F && f, Rest&&... rest) {
-            _pool.push(f, rest...);
-        }
+        void push(Task&& task);
+        void resize(int threads);
+        int size();
+        void setWorkerSetup(std::function<void(int, thread&)> setup);
+        void setWakeupLatency(LatencyHistogram* wakeupLatency);
+        void stop();
 
-        template<typename F>
-        void push(F&& f) {
-            _pool.push(f);
-        }
+    private:
+        struct QueuedTask {
+            Task _task;
+            /**
+             * Push time in microseconds, 0 while the wakeup latency is not measured
+             */
+            int64_t _queued;
+        };
 
-        void stop() {
-            _pool.stop(false);
-        }
+        /**
+         * The deque lock is only held to move a task in or out, so owner and thieves rarely meet.
+         */
+        struct Worker {
+            std::mutex _mutex;
+            std::deque<QueuedTask> _tasks;
+            std::atomic<bool> _stop{false};
+            int _id = 0;
+            thread _thread;
+        };
 
-    private:
-        ctpl::thread_pool _pool;
+        /**
+         * Guards the worker list, exclusive only while resizing
+         */
+        std::shared_mutex _workersMutex;
+        vector<std::unique_ptr<Worker>> _workers;
+        std::atomic<unsigned int> _nextWorker;
+        std::atomic<long> _pending;
+        std::atomic<int> _sleeping;
+        std::mutex _idleMutex;
+        std::condition_variable _idle;
+        std::function<void(int, thread&)> _workerSetup;
+        std::atomic<LatencyHistogram*> _wakeupLatency;
+        bool _stopped;
+
+        void run(Worker* worker);
+        optional<QueuedTask> take(Worker* worker);
+        static optional<QueuedTask> popFront(Worker& worker);
+        static int64_t now();
+        void startWorkers(int threads);
+        void wake(bool all);
     };
-}
\ No newline at end of file
+}
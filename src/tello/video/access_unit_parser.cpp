@@ -0,0 +1,126 @@
+#include "access_unit_parser.hpp"
+#include "start_code.hpp"
+
+using tello::NalUnitType;
+
+namespace {
+
+    bool startsAccessUnit(NalUnitType type, unsigned char firstSliceByte) {
+        switch (type) {
+            case NalUnitType::ACCESS_UNIT_DELIMITER:
+            case NalUnitType::SEI:
+            case NalUnitType::SPS:
+            case NalUnitType::PPS:
+                return true;
+            case NalUnitType::NON_IDR_SLICE:
+            case NalUnitType::IDR_SLICE:
+            case NalUnitType::PARTITION_A:
+                // first_mb_in_slice is ue(v), a leading 1 bit encodes 0
+                return (firstSliceByte & 0x80) != 0;
+            default:
+                return false;
+        }
+    }
+}
+
+tello::video::AccessUnitParser::AccessUnitParser() : AccessUnitParser(nullptr) {
+}
+
+tello::video::AccessUnitParser::AccessUnitParser(NalUnitListener* listener)
+        : _scanned(0), _spsHeader(), _info(), _format(), _hasFormat(false), _slices(0), _listener(listener),
+          _nalUnitBegin() {
+}
+
+optional<size_t> tello::video::AccessUnitParser::scan(const unsigned char* frame, size_t length) {
+    size_t position;
+    while ((position = findStartCode(frame, _scanned, length)) != START_CODE_NOT_FOUND) {
+        size_t header = position + 3;
+        if (header + 1 >= length) {
+            // NAL header or first slice byte not received yet
+            _scanned = position;
+            return std::nullopt;
+        }
+
+        size_t begin = startCodeBegin(frame, position);
+        NalUnitType type = nalUnitType(frame[header]);
+        if (begin > 0 && hasPicture() && startsAccessUnit(type, frame[header + 1])) {
+            endNalUnit(frame, begin, true);
+            _scanned = position;
+            return begin;
+        }
+
+        endNalUnit(frame, begin, false);
+        _nalUnitBegin = begin;
+        _info._nalUnits++;
+        if (isSlice(type)) {
+            if (_slices == 0) {
+                _info._nalType = type;
+            }
+            _slices++;
+            _info._keyframe = _info._keyframe || type == NalUnitType::IDR_SLICE;
+            _info._reference = _info._reference || (frame[header] & 0x60) != 0;
+        } else if (type == NalUnitType::SPS || type == NalUnitType::PPS) {
+            if (type == NalUnitType::SPS) {
+                _spsHeader = header;
+            }
+            if (_info._nalType == NalUnitType::UNSPECIFIED) {
+                _info._nalType = type;
+            }
+            _info._parameterSets = true;
+        }
+        _scanned = header + 1;
+    }
+
+    if (length >= 2 && _scanned < length - 2) {
+        _scanned = length - 2;
+    }
+    return std::nullopt;
+}
+
+void tello::video::AccessUnitParser::finish(const unsigned char* frame, size_t length) {
+    endNalUnit(frame, length, true);
+}
+
+void tello::video::AccessUnitParser::reset() {
+    _scanned = 0;
+    _spsHeader.reset();
+    _info = FrameInfo();
+    _info._format = _format;
+    _slices = 0;
+    _nalUnitBegin.reset();
+}
+
+bool tello::video::AccessUnitParser::hasPicture() const {
+    return _slices > 0;
+}
+
+bool tello::video::AccessUnitParser::hasFormat() const {
+    return _hasFormat;
+}
+
+FrameInfo tello::video::AccessUnitParser::info() const {
+    return _info;
+}
+
+const VideoFormat& tello::video::AccessUnitParser::format() const {
+    return _format;
+}
+
+void tello::video::AccessUnitParser::endNalUnit(const unsigned char* frame, size_t end, bool lastInFrame) {
+    if (_listener != nullptr && _nalUnitBegin) {
+        _listener->nalUnit(frame, *_nalUnitBegin, end, lastInFrame);
+    }
+    _nalUnitBegin.reset();
+
+    if (!_spsHeader) {
+        return;
+    }
+
+    VideoFormat format;
+    if (parseSps(frame + *_spsHeader, end - *_spsHeader, format)) {
+        _format = format;
+        _info._format = format;
+        _hasFormat = true;
+    }
+    _spsHeader.reset();
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <tello/video/h264.hpp>
+
+using std::optional;
+using tello::FrameInfo;
+using tello::VideoFormat;
+
+namespace tello::video {
+
+    /**
+     * Gets every NAL unit as soon as its end is known: at the next start code or the end of the access unit.
+     */
+    class NalUnitListener {
+    public:
+        virtual ~NalUnitListener() = default;
+
+        /**
+         * @param begin offset of the start code inside 'frame'
+         * @param end offset behind the last byte of the NAL unit
+         */
+        virtual void nalUnit(const unsigned char* frame, size_t begin, size_t end, bool lastInFrame) = 0;
+    };
+
+    /**
+     * Streaming Annex-B parser of one drone. It is fed with a growing, contiguous frame buffer
+     * and finds the start of the next access unit (ITU-T H.264, 7.4.1.2.3):
+     * an AUD, SEI, SPS or PPS, or a slice with first_mb_in_slice 0 after the first slice of the frame.
+     */
+    class AccessUnitParser {
+    public:
+        AccessUnitParser();
+        explicit AccessUnitParser(NalUnitListener* listener);
+
+        /**
+         * Scans the bytes of 'frame' not scanned yet. Start codes split between two calls are found.
+         * @return offset of the next access unit, if 'frame' holds a complete access unit before it
+         */
+        optional<size_t> scan(const unsigned char* frame, size_t length);
+
+        /**
+         * Ends the current access unit at 'length' without a following start code
+         */
+        void finish(const unsigned char* frame, size_t length);
+
+        /**
+         * Starts a new access unit, the stream format is kept
+         */
+        void reset();
+
+        [[nodiscard]] bool hasPicture() const;
+        [[nodiscard]] bool hasFormat() const;
+        [[nodiscard]] FrameInfo info() const;
+        [[nodiscard]] const VideoFormat& format() const;
+
+    private:
+        size_t _scanned;
+        optional<size_t> _spsHeader;
+        FrameInfo _info;
+        VideoFormat _format;
+        bool _hasFormat;
+        unsigned int _slices;
+        NalUnitListener* _listener;
+        optional<size_t> _nalUnitBegin;
+
+        void endNalUnit(const unsigned char* frame, size_t end, bool lastInFrame);
+    };
+}
@@ -0,0 +1,72 @@
+#include <tello/video/frame_buffer.hpp>
+#include <cstring>
+
+tello::FrameBuffer::FrameBuffer(size_t capacity) : _data(new unsigned char[capacity]), _capacity(capacity),
+                                                   _length(0), _info(), _references(0),
+                                                   _recycler() {
+}
+
+tello::FrameBuffer::~FrameBuffer() {
+    delete[] _data;
+    _data = nullptr;
+}
+
+const unsigned char* tello::FrameBuffer::data() const {
+    return _data;
+}
+
+size_t tello::FrameBuffer::length() const {
+    return _length;
+}
+
+size_t tello::FrameBuffer::capacity() const {
+    return _capacity;
+}
+
+unsigned char* tello::FrameBuffer::tail() {
+    return _data + _length;
+}
+
+size_t tello::FrameBuffer::available() const {
+    return _capacity - _length;
+}
+
+void tello::FrameBuffer::reserve(size_t available) {
+    if (_capacity - _length >= available) {
+        return;
+    }
+
+    size_t capacity = _capacity * 2;
+    while (capacity - _length < available) {
+        capacity *= 2;
+    }
+
+    auto* data = new unsigned char[capacity];
+    std::memcpy(data, _data, _length);
+    delete[] _data;
+    _data = data;
+    _capacity = capacity;
+}
+
+void tello::FrameBuffer::commit(size_t length) {
+    _length += length;
+}
+
+void tello::FrameBuffer::truncate(size_t length) {
+    if (length < _length) {
+        _length = length;
+    }
+}
+
+void tello::FrameBuffer::clear() {
+    _length = 0;
+    _info = FrameInfo();
+}
+
+const tello::FrameInfo& tello::FrameBuffer::info() const {
+    return _info;
+}
+
+void tello::FrameBuffer::setInfo(const FrameInfo& info) {
+    _info = info;
+}
@@ -0,0 +1,80 @@
+#include <tello/video/frame_handle.hpp>
+
+tello::FrameHandle::FrameHandle() noexcept : _frame(nullptr) {
+}
+
+tello::FrameHandle::FrameHandle(FrameBuffer* frame) noexcept : _frame(frame) {
+    if (_frame != nullptr) {
+        _frame->_references.store(1, std::memory_order_relaxed);
+    }
+}
+
+tello::FrameHandle::FrameHandle(const FrameHandle& other) noexcept : _frame(other._frame) {
+    if (_frame != nullptr) {
+        _frame->_references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+tello::FrameHandle& tello::FrameHandle::operator=(const FrameHandle& other) noexcept {
+    if (this != &other) {
+        if (other._frame != nullptr) {
+            other._frame->_references.fetch_add(1, std::memory_order_relaxed);
+        }
+        reset();
+        _frame = other._frame;
+    }
+    return *this;
+}
+
+tello::FrameHandle::FrameHandle(FrameHandle&& other) noexcept : _frame(other._frame) {
+    other._frame = nullptr;
+}
+
+tello::FrameHandle& tello::FrameHandle::operator=(FrameHandle&& other) noexcept {
+    if (this != &other) {
+        reset();
+        _frame = other._frame;
+        other._frame = nullptr;
+    }
+    return *this;
+}
+
+tello::FrameHandle::~FrameHandle() {
+    reset();
+}
+
+const unsigned char* tello::FrameHandle::data() const {
+    return _frame != nullptr ? _frame->data() : nullptr;
+}
+
+size_t tello::FrameHandle::length() const {
+    return _frame != nullptr ? _frame->length() : 0;
+}
+
+const tello::FrameInfo& tello::FrameHandle::info() const {
+    static const FrameInfo EMPTY_INFO;
+    return _frame != nullptr ? _frame->info() : EMPTY_INFO;
+}
+
+unsigned int tello::FrameHandle::useCount() const {
+    return _frame != nullptr ? _frame->_references.load(std::memory_order_relaxed) : 0;
+}
+
+tello::FrameHandle::operator bool() const {
+    return _frame != nullptr;
+}
+
+void tello::FrameHandle::reset() {
+    FrameBuffer* frame = _frame;
+    _frame = nullptr;
+    if (frame == nullptr || frame->_references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    shared_ptr<FrameRecycler> recycler = std::move(frame->_recycler);
+    if (recycler != nullptr) {
+        recycler->recycle(frame);
+    } else {
+        delete frame;
+    }
+}
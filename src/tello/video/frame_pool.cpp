@@ -0,0 +1,93 @@
+#include "frame_pool.hpp"
+#include <algorithm>
+
+tello::video::FramePool::FramePool(size_t bufferCapacity, size_t maxPooled) : _bufferCapacity(bufferCapacity),
+                                                                              _maxPooled(maxPooled), _mutex(),
+                                                                              _free(), _allocated(0),
+                                                                              _allocationForbidden(false),
+                                                                              _refused(0) {
+    _free.reserve(maxPooled);
+}
+
+tello::video::FramePool::~FramePool() {
+    for (FrameBuffer* buffer : _free) {
+        delete buffer;
+    }
+    _free.clear();
+}
+
+FrameBuffer* tello::video::FramePool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_free.empty()) {
+            FrameBuffer* buffer = _free.back();
+            _free.pop_back();
+            return buffer;
+        }
+    }
+
+    if (_allocationForbidden.load(std::memory_order_relaxed)) {
+        _refused++;
+        return nullptr;
+    }
+    _allocated++;
+    return new FrameBuffer(_bufferCapacity);
+}
+
+void tello::video::FramePool::release(FrameBuffer* buffer) {
+    if (buffer == nullptr) {
+        return;
+    }
+
+    buffer->clear();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_free.size() < _maxPooled) {
+            _free.push_back(buffer);
+            return;
+        }
+    }
+
+    _allocated--;
+    delete buffer;
+}
+
+FrameHandle tello::video::FramePool::share(FrameBuffer* buffer) {
+    buffer->_recycler = shared_from_this();
+    return FrameHandle{buffer};
+}
+
+void tello::video::FramePool::recycle(FrameBuffer* frame) {
+    release(frame);
+}
+
+void tello::video::FramePool::preallocate(size_t buffers) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxPooled = std::max(_maxPooled, buffers);
+    _free.reserve(_maxPooled);
+    while (_free.size() < buffers) {
+        _free.push_back(new FrameBuffer(_bufferCapacity));
+        _allocated++;
+    }
+}
+
+void tello::video::FramePool::forbidAllocation(bool forbidden) {
+    _allocationForbidden.store(forbidden, std::memory_order_relaxed);
+}
+
+bool tello::video::FramePool::allocationForbidden() const {
+    return _allocationForbidden.load(std::memory_order_relaxed);
+}
+
+size_t tello::video::FramePool::pooled() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _free.size();
+}
+
+size_t tello::video::FramePool::allocated() const {
+    return _allocated;
+}
+
+size_t tello::video::FramePool::refused() const {
+    return _refused;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+
+#define FRAME_BUFFER_CAPACITY (256 * 1024)
+#define FRAME_POOL_SIZE 16
+
+using std::vector;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::FrameRecycler;
+
+namespace tello::video {
+
+    /**
+     * Recycles frame buffers, so reassembly does not allocate once the pool is warm.
+     * Buffers keep the capacity they have grown to.
+     * The pool must be owned by a shared_ptr, shared frames keep it alive.
+     */
+    class FramePool : public FrameRecycler, public std::enable_shared_from_this<FramePool> {
+    public:
+        explicit FramePool(size_t bufferCapacity = FRAME_BUFFER_CAPACITY, size_t maxPooled = FRAME_POOL_SIZE);
+        FramePool(const FramePool&) = delete;
+        FramePool& operator=(const FramePool&) = delete;
+        ~FramePool() override;
+
+        /**
+         * @return nullptr, if no buffer is free and allocation is forbidden
+         */
+        [[nodiscard]] FrameBuffer* acquire();
+        void release(FrameBuffer* buffer);
+
+        /**
+         * Turns an acquired buffer into an immutable frame, which returns to the pool with its last handle.
+         */
+        [[nodiscard]] FrameHandle share(FrameBuffer* buffer);
+        void recycle(FrameBuffer* frame) override;
+
+        /**
+         * Allocates free buffers up to 'buffers', the pool keeps at least as many
+         */
+        void preallocate(size_t buffers);
+
+        /**
+         * Real-time mode: 'acquire' only hands out free buffers
+         */
+        void forbidAllocation(bool forbidden);
+        [[nodiscard]] bool allocationForbidden() const;
+
+        [[nodiscard]] size_t pooled() const;
+        [[nodiscard]] size_t allocated() const;
+
+        /**
+         * Acquisitions failed, because allocation was forbidden
+         */
+        [[nodiscard]] size_t refused() const;
+
+    private:
+        const size_t _bufferCapacity;
+        size_t _maxPooled;
+        mutable std::mutex _mutex;
+        vector<FrameBuffer*> _free;
+        std::atomic<size_t> _allocated;
+        std::atomic<bool> _allocationForbidden;
+        std::atomic<size_t> _refused;
+    };
+}
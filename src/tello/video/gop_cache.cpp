@@ -0,0 +1,96 @@
+#include <tello/video/gop_cache.hpp>
+
+using tello::FrameHandle;
+
+tello::GopCache::GopCache(size_t maxFrames, GopCacheMode mode) : _mutex(), _maxFrames(maxFrames > 0 ? maxFrames : 1),
+                                                                 _mode(mode), _parameterSets(), _frames(),
+                                                                 _complete(false) {
+}
+
+void tello::GopCache::push(const FrameHandle& frame) {
+    GopCacheMode mode = _mode.load(std::memory_order_relaxed);
+    if (mode == GopCacheMode::DISABLED) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const FrameInfo& info = frame.info();
+    if (mode == GopCacheMode::KEYFRAME) {
+        if (info._keyframe) {
+            _frames.assign(1, frame);
+        }
+        return;
+    }
+
+    if (info._parameterSets && !info._keyframe) {
+        _parameterSets = frame;
+    }
+
+    if (info._keyframe) {
+        _frames.clear();
+        _frames.reserve(_maxFrames);
+        _frames.push_back(frame);
+        _complete = true;
+    } else if (_complete && _frames.size() < _maxFrames) {
+        _frames.push_back(frame);
+    } else if (_complete) {
+        // keep the keyframe for snapshots only
+        _frames.resize(1);
+        _complete = false;
+    }
+}
+
+void tello::GopCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _parameterSets.reset();
+    _frames.clear();
+    _complete = false;
+}
+
+void tello::GopCache::require(GopCacheMode mode) {
+    GopCacheMode current = _mode.load(std::memory_order_relaxed);
+    while (current < mode && !_mode.compare_exchange_weak(current, mode, std::memory_order_relaxed)) {
+    }
+}
+
+tello::GopCacheMode tello::GopCache::mode() const {
+    return _mode.load(std::memory_order_relaxed);
+}
+
+void tello::GopCache::limit(size_t maxFrames) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxFrames = maxFrames > 0 ? maxFrames : 1;
+    if (_frames.size() > _maxFrames) {
+        _frames.resize(1);
+        _complete = false;
+    }
+}
+
+FrameHandle tello::GopCache::snapshot() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _frames.empty() ? FrameHandle{} : _frames.front();
+}
+
+vector<FrameHandle> tello::GopCache::gop() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return copyGop();
+}
+
+void tello::GopCache::gop(const std::function<void(vector<FrameHandle>&&)>& consumer) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    consumer(copyGop());
+}
+
+vector<FrameHandle> tello::GopCache::copyGop() const {
+    vector<FrameHandle> gop;
+    if (!_complete) {
+        return gop;
+    }
+
+    gop.reserve(_frames.size() + 1);
+    if (_parameterSets && !_frames.front().info()._parameterSets) {
+        gop.push_back(_parameterSets);
+    }
+    gop.insert(gop.end(), _frames.begin(), _frames.end());
+    return gop;
+}
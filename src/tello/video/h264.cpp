@@ -0,0 +1,220 @@
+#include <tello/video/h264.hpp>
+
+#define SPS_MAX_LENGTH 256
+
+using tello::NalUnitType;
+using tello::VideoFormat;
+
+namespace {
+
+    /**
+     * Reads bits of a raw byte sequence payload (emulation prevention bytes removed)
+     */
+    class BitReader {
+    public:
+        BitReader(const unsigned char* data, size_t length) : _data(data), _length(length), _position(0),
+                                                              _overflow(false) {}
+
+        uint32_t bits(int count) {
+            uint32_t value = 0;
+            for (int i = 0; i < count; i++) {
+                value = (value << 1) | bit();
+            }
+            return value;
+        }
+
+        uint32_t bit() {
+            if (_position >= _length * 8) {
+                _overflow = true;
+                return 0;
+            }
+            uint32_t value = (_data[_position / 8] >> (7 - _position % 8)) & 1;
+            _position++;
+            return value;
+        }
+
+        uint32_t ue() {
+            int leadingZeros = 0;
+            while (bit() == 0) {
+                if (_overflow || ++leadingZeros > 31) {
+                    _overflow = true;
+                    return 0;
+                }
+            }
+            return ((1u << leadingZeros) - 1) + bits(leadingZeros);
+        }
+
+        int32_t se() {
+            uint32_t value = ue();
+            return (value & 1) ? static_cast<int32_t>((value + 1) / 2) : -static_cast<int32_t>(value / 2);
+        }
+
+        [[nodiscard]] bool overflow() const {
+            return _overflow;
+        }
+
+    private:
+        const unsigned char* _data;
+        size_t _length;
+        size_t _position;
+        bool _overflow;
+    };
+
+    size_t removeEmulationPrevention(const unsigned char* data, size_t length, unsigned char* rbsp) {
+        size_t written = 0;
+        int zeros = 0;
+        for (size_t i = 0; i < length && written < SPS_MAX_LENGTH; i++) {
+            if (zeros >= 2 && data[i] == 3) {
+                zeros = 0;
+                continue;
+            }
+            zeros = data[i] == 0 ? zeros + 1 : 0;
+            rbsp[written++] = data[i];
+        }
+        return written;
+    }
+
+    void skipScalingList(BitReader& reader, int size) {
+        int32_t lastScale = 8;
+        int32_t nextScale = 8;
+        for (int i = 0; i < size && !reader.overflow(); i++) {
+            if (nextScale != 0) {
+                int32_t delta = reader.se();
+                nextScale = (lastScale + delta + 256) % 256;
+            }
+            lastScale = nextScale == 0 ? lastScale : nextScale;
+        }
+    }
+
+    bool hasChromaInfo(uint32_t profile) {
+        return profile == 100 || profile == 110 || profile == 122 || profile == 244 || profile == 44 ||
+               profile == 83 || profile == 86 || profile == 118 || profile == 128 || profile == 138 ||
+               profile == 139 || profile == 134 || profile == 135;
+    }
+
+    void readFrameRate(BitReader& reader, VideoFormat& format) {
+        if (reader.bit()) { // aspect_ratio_info_present_flag
+            if (reader.bits(8) == 255) { // Extended_SAR
+                reader.bits(16);
+                reader.bits(16);
+            }
+        }
+        if (reader.bit()) { // overscan_info_present_flag
+            reader.bit();
+        }
+        if (reader.bit()) { // video_signal_type_present_flag
+            reader.bits(4);
+            if (reader.bit()) { // colour_description_present_flag
+                reader.bits(24);
+            }
+        }
+        if (reader.bit()) { // chroma_loc_info_present_flag
+            reader.ue();
+            reader.ue();
+        }
+        if (reader.bit()) { // timing_info_present_flag
+            uint32_t unitsInTick = reader.bits(32);
+            uint32_t timeScale = reader.bits(32);
+            if (!reader.overflow() && unitsInTick > 0) {
+                format._frameRate = static_cast<double>(timeScale) / (2.0 * unitsInTick);
+            }
+        }
+    }
+}
+
+NalUnitType tello::nalUnitType(unsigned char header) {
+    return static_cast<NalUnitType>(header & 0x1F);
+}
+
+bool tello::isSlice(NalUnitType type) {
+    return type == NalUnitType::NON_IDR_SLICE || type == NalUnitType::IDR_SLICE ||
+           type == NalUnitType::PARTITION_A;
+}
+
+bool tello::parseSps(const unsigned char* data, size_t length, VideoFormat& format) {
+    if (length < 4 || nalUnitType(data[0]) != NalUnitType::SPS) {
+        return false;
+    }
+
+    unsigned char rbsp[SPS_MAX_LENGTH];
+    size_t rbspLength = removeEmulationPrevention(data + 1, length - 1, rbsp);
+    BitReader reader{rbsp, rbspLength};
+
+    uint32_t profile = reader.bits(8);
+    reader.bits(8); // constraint flags
+    uint32_t level = reader.bits(8);
+    reader.ue(); // seq_parameter_set_id
+
+    uint32_t chromaFormat = 1;
+    if (hasChromaInfo(profile)) {
+        chromaFormat = reader.ue();
+        if (chromaFormat == 3) {
+            reader.bit(); // separate_colour_plane_flag
+        }
+        reader.ue(); // bit_depth_luma_minus8
+        reader.ue(); // bit_depth_chroma_minus8
+        reader.bit(); // qpprime_y_zero_transform_bypass_flag
+        if (reader.bit()) { // seq_scaling_matrix_present_flag
+            int lists = chromaFormat != 3 ? 8 : 12;
+            for (int i = 0; i < lists; i++) {
+                if (reader.bit()) {
+                    skipScalingList(reader, i < 6 ? 16 : 64);
+                }
+            }
+        }
+    }
+
+    reader.ue(); // log2_max_frame_num_minus4
+    uint32_t pocType = reader.ue();
+    if (pocType == 0) {
+        reader.ue(); // log2_max_pic_order_cnt_lsb_minus4
+    } else if (pocType == 1) {
+        reader.bit(); // delta_pic_order_always_zero_flag
+        reader.se(); // offset_for_non_ref_pic
+        reader.se(); // offset_for_top_to_bottom_field
+        uint32_t cycle = reader.ue();
+        for (uint32_t i = 0; i < cycle && !reader.overflow(); i++) {
+            reader.se();
+        }
+    }
+
+    reader.ue(); // max_num_ref_frames
+    reader.bit(); // gaps_in_frame_num_value_allowed_flag
+    uint32_t widthInMbs = reader.ue() + 1;
+    uint32_t heightInMapUnits = reader.ue() + 1;
+    uint32_t frameMbsOnly = reader.bit();
+    if (!frameMbsOnly) {
+        reader.bit(); // mb_adaptive_frame_field_flag
+    }
+    reader.bit(); // direct_8x8_inference_flag
+
+    uint32_t cropLeft = 0, cropRight = 0, cropTop = 0, cropBottom = 0;
+    if (reader.bit()) { // frame_cropping_flag
+        cropLeft = reader.ue();
+        cropRight = reader.ue();
+        cropTop = reader.ue();
+        cropBottom = reader.ue();
+    }
+
+    VideoFormat parsed;
+    if (reader.bit()) { // vui_parameters_present_flag
+        readFrameRate(reader, parsed);
+    }
+
+    if (reader.overflow()) {
+        return false;
+    }
+
+    uint32_t cropUnitX = chromaFormat == 1 || chromaFormat == 2 ? 2 : 1;
+    uint32_t cropUnitY = (chromaFormat == 1 ? 2 : 1) * (2 - frameMbsOnly);
+    if (chromaFormat == 0) {
+        cropUnitY = 2 - frameMbsOnly;
+    }
+
+    parsed._width = widthInMbs * 16 - cropUnitX * (cropLeft + cropRight);
+    parsed._height = (2 - frameMbsOnly) * heightInMapUnits * 16 - cropUnitY * (cropTop + cropBottom);
+    parsed._profile = static_cast<int>(profile);
+    parsed._level = static_cast<int>(level);
+    format = parsed;
+    return true;
+}
@@ -0,0 +1,83 @@
+#include "rtp_packetizer.hpp"
+#include "start_code.hpp"
+
+using tello::video::RtpPacket;
+
+namespace {
+
+    void writeBigEndian(unsigned char* target, uint32_t value, int bytes) {
+        for (int i = bytes - 1; i >= 0; i--) {
+            target[i] = static_cast<unsigned char>(value & 0xFF);
+            value >>= 8;
+        }
+    }
+}
+
+tello::video::RtpPacketizer::RtpPacketizer(uint32_t ssrc, uint8_t payloadType, size_t maxPayload)
+        : _ssrc(ssrc), _payloadType(payloadType & 0x7F),
+          _maxPayload(maxPayload > RTP_FU_HEADER_LENGTH ? maxPayload : RTP_FU_HEADER_LENGTH + 1), _sequence(0),
+          _packets() {
+}
+
+const vector<RtpPacket>& tello::video::RtpPacketizer::packetize(const unsigned char* frame, size_t length,
+                                                                int64_t timestamp) {
+    _packets.clear();
+    auto rtpTimestamp = static_cast<uint32_t>(timestamp * RTP_CLOCK_RATE / 1000000);
+
+    size_t position = findStartCode(frame, 0, length);
+    while (position != START_CODE_NOT_FOUND) {
+        size_t begin = position + 3;
+        size_t next = findStartCode(frame, begin, length);
+        size_t end = next == START_CODE_NOT_FOUND ? length : startCodeBegin(frame, next);
+        if (end > begin) {
+            addNalUnit(frame + begin, end - begin, rtpTimestamp);
+        }
+        position = next;
+    }
+
+    if (!_packets.empty()) {
+        _packets.back()._header[1] |= 0x80;
+    }
+    return _packets;
+}
+
+uint16_t tello::video::RtpPacketizer::sequence() const {
+    return _sequence;
+}
+
+void tello::video::RtpPacketizer::addNalUnit(const unsigned char* nalUnit, size_t length, uint32_t timestamp) {
+    if (length <= _maxPayload) {
+        RtpPacket& packet = addPacket(timestamp);
+        packet._payload = nalUnit;
+        packet._payloadLength = length;
+        return;
+    }
+
+    // FU-A: the NAL header is replaced by the FU indicator and the FU header of every fragment
+    unsigned char indicator = (nalUnit[0] & 0xE0) | RTP_FU_A;
+    unsigned char type = nalUnit[0] & 0x1F;
+    size_t fragmentLength = _maxPayload - RTP_FU_HEADER_LENGTH;
+    for (size_t offset = 1; offset < length; offset += fragmentLength) {
+        size_t remaining = length - offset;
+        RtpPacket& packet = addPacket(timestamp);
+        packet._header[RTP_HEADER_LENGTH] = indicator;
+        bool first = offset == 1;
+        bool last = remaining <= fragmentLength;
+        packet._header[RTP_HEADER_LENGTH + 1] = type | (first ? 0x80 : 0) | (last ? 0x40 : 0);
+        packet._headerLength = RTP_HEADER_LENGTH + RTP_FU_HEADER_LENGTH;
+        packet._payload = nalUnit + offset;
+        packet._payloadLength = remaining < fragmentLength ? remaining : fragmentLength;
+    }
+}
+
+RtpPacket& tello::video::RtpPacketizer::addPacket(uint32_t timestamp) {
+    _packets.emplace_back();
+    RtpPacket& packet = _packets.back();
+    packet._header[0] = 0x80; // version 2
+    packet._header[1] = _payloadType;
+    writeBigEndian(packet._header + 2, _sequence++, 2);
+    writeBigEndian(packet._header + 4, timestamp, 4);
+    writeBigEndian(packet._header + 8, _ssrc, 4);
+    packet._headerLength = RTP_HEADER_LENGTH;
+    return packet;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define RTP_HEADER_LENGTH 12
+#define RTP_FU_HEADER_LENGTH 2
+#define RTP_MAX_PAYLOAD 1400
+#define RTP_CLOCK_RATE 90000
+#define RTP_DYNAMIC_PAYLOAD_TYPE 96
+#define RTP_FU_A 28
+
+using std::vector;
+
+namespace tello::video {
+
+    /**
+     * RTP packet as header bytes and a view of the payload inside the frame
+     */
+    struct RtpPacket {
+        unsigned char _header[RTP_HEADER_LENGTH + RTP_FU_HEADER_LENGTH];
+        size_t _headerLength;
+        const unsigned char* _payload;
+        size_t _payloadLength;
+    };
+
+    /**
+     * Packetizes Annex-B access units into RTP (RFC 6184): single NAL unit packets and FU-A fragments
+     * of the NAL units longer than 'maxPayload'. The marker bit ends an access unit.
+     */
+    class RtpPacketizer {
+    public:
+        explicit RtpPacketizer(uint32_t ssrc, uint8_t payloadType = RTP_DYNAMIC_PAYLOAD_TYPE,
+                               size_t maxPayload = RTP_MAX_PAYLOAD);
+
+        /**
+         * @param timestamp capture time in microseconds, converted to the 90 kHz clock
+         * @return packets referencing 'frame', valid until the next call
+         */
+        const vector<RtpPacket>& packetize(const unsigned char* frame, size_t length, int64_t timestamp);
+
+        [[nodiscard]] uint16_t sequence() const;
+
+    private:
+        const uint32_t _ssrc;
+        const uint8_t _payloadType;
+        const size_t _maxPayload;
+        uint16_t _sequence;
+        vector<RtpPacket> _packets;
+
+        void addNalUnit(const unsigned char* nalUnit, size_t length, uint32_t timestamp);
+        RtpPacket& addPacket(uint32_t timestamp);
+    };
+}
@@ -0,0 +1,82 @@
+#include <tello/video/rtp_streamer.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "rtp_packetizer.hpp"
+#include "../native/network_interface_factory.hpp"
+#include <algorithm>
+#include <chrono>
+
+using tello::LoggerType;
+using tello::NetworkData;
+using tello::SendBuffer;
+using tello::video::RtpPacket;
+using tello::video::RtpPacketizer;
+
+tello::RtpStreamer::RtpStreamer(uint32_t ssrc, uint8_t payloadType)
+        : _networkInterface(NetworkInterfaceFactory::build()), _connection(),
+          _packetizer(std::make_unique<RtpPacketizer>(ssrc, payloadType)), _sinksMutex(), _sinks(), _packetsSent(0),
+          _sendErrors(0) {
+    // any free local port, the socket is only used for sending
+    _connection = _networkInterface->connect(NetworkData{SIN_FAM::I_AF_INET, 0, 0}, LoggerType::VIDEO);
+}
+
+tello::RtpStreamer::~RtpStreamer() {
+    if (_connection) {
+        _networkInterface->disconnect(_connection->_fileDescriptor);
+    }
+}
+
+void tello::RtpStreamer::addSink(unsigned short port, ip_address address) {
+    std::lock_guard<std::mutex> lock(_sinksMutex);
+    _sinks.emplace_back(SIN_FAM::I_AF_INET, port, address);
+}
+
+void tello::RtpStreamer::removeSink(unsigned short port, ip_address address) {
+    std::lock_guard<std::mutex> lock(_sinksMutex);
+    _sinks.erase(std::remove_if(_sinks.begin(), _sinks.end(), [port, address](const NetworkData& sink) {
+        return sink._port == port && sink._ip == address;
+    }), _sinks.end());
+}
+
+bool tello::RtpStreamer::send(const FrameHandle& frame) {
+    if (!_connection || !frame) {
+        return false;
+    }
+
+    // the receive time keeps the frame spacing of the drone, frames drained together are sent back to back
+    int64_t timestamp = frame.info()._receiveTime;
+    if (timestamp == 0) {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+    }
+    const vector<RtpPacket>& packets = _packetizer->packetize(frame.data(), frame.length(), timestamp);
+
+    bool sent = true;
+    std::lock_guard<std::mutex> lock(_sinksMutex);
+    for (const RtpPacket& packet : packets) {
+        SendBuffer buffers[2] = {
+                {reinterpret_cast<const char*>(packet._header), packet._headerLength},
+                {reinterpret_cast<const char*>(packet._payload), packet._payloadLength}
+        };
+        for (const NetworkData& sink : _sinks) {
+            if (_networkInterface->send(_connection->_fileDescriptor, sink, buffers, 2) == SEND_ERROR_CODE) {
+                _sendErrors++;
+                sent = false;
+            } else {
+                _packetsSent++;
+            }
+        }
+    }
+    return sent;
+}
+
+bool tello::RtpStreamer::send(const VideoResponse& frame) {
+    return send(frame.frame());
+}
+
+unsigned long long tello::RtpStreamer::packetsSent() const {
+    return _packetsSent;
+}
+
+unsigned long long tello::RtpStreamer::sendErrors() const {
+    return _sendErrors;
+}
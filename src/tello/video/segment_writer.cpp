@@ -0,0 +1,133 @@
+#include "segment_writer.hpp"
+#include "video_index_format.hpp"
+#include <tello/logger/logger_interface.hpp>
+#include <cstring>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::NalUnitType;
+using tello::video::VideoIndexHeader;
+using tello::video::VideoIndexRecord;
+using tello::video::VideoKeyframeTrailer;
+
+tello::video::SegmentWriter::SegmentWriter(string directory, ip_address drone, uint64_t session,
+                                           const VideoSegmentPolicy& policy)
+        : _directory(std::move(directory)), _drone(drone), _session(session), _policy(policy), _file(nullptr),
+          _index(nullptr),
+          _buffer(), _keyframes(), _entries(0), _segment(0), _segmentStart(0), _segmentBytes(0), _parameterSets() {
+}
+
+tello::video::SegmentWriter::~SegmentWriter() {
+    close();
+}
+
+bool tello::video::SegmentWriter::write(const FrameHandle& frame, int64_t timestamp) {
+    const FrameInfo& info = frame.info();
+    if (info._parameterSets && !info._keyframe) {
+        _parameterSets = frame;
+    }
+
+    if (info._keyframe) {
+        bool full = timestamp - _segmentStart >= _policy._maxDuration || _segmentBytes >= _policy._maxBytes;
+        if (_file == nullptr || full) {
+            close();
+            if (!open(timestamp)) {
+                return false;
+            }
+            if (!info._parameterSets && _parameterSets && !append(_parameterSets, timestamp)) {
+                return false;
+            }
+        }
+    }
+
+    return _file != nullptr && append(frame, timestamp);
+}
+
+void tello::video::SegmentWriter::close() {
+    closeIndex();
+    if (_file != nullptr) {
+        std::fclose(_file);
+        _file = nullptr;
+    }
+}
+
+unsigned int tello::video::SegmentWriter::segments() const {
+    return _segment;
+}
+
+bool tello::video::SegmentWriter::open(int64_t timestamp) {
+    string path = VideoRecorder::path(_directory, _drone, _session, _segment + 1);
+    _file = std::fopen(path.c_str(), "wb");
+    if (_file == nullptr) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Cannot open video segment {}"), path);
+        return false;
+    }
+
+    // the buffer has to outlive the stream, it is kept for the next segment
+    _buffer.resize(VIDEO_WRITE_BUFFER_LENGTH);
+    std::setvbuf(_file, _buffer.data(), _IOFBF, _buffer.size());
+    _segment++;
+    _segmentStart = timestamp;
+    _segmentBytes = 0;
+
+    // the video stays playable without its index, a failing index is only logged
+    string indexPath = VideoRecorder::indexPath(_directory, _drone, _session, _segment);
+    _index = std::fopen(indexPath.c_str(), "wb");
+    VideoIndexHeader header{};
+    std::memcpy(header._magic, VIDEO_INDEX_MAGIC, sizeof(VIDEO_INDEX_MAGIC));
+    header._version = VIDEO_INDEX_VERSION;
+    header._drone = _drone;
+    header._segment = _segment;
+    header._entrySize = sizeof(VideoIndexRecord);
+    if (_index == nullptr || std::fwrite(&header, sizeof(header), 1, _index) != 1) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Cannot write video index {}"), indexPath);
+        closeIndex();
+    }
+    _keyframes.clear();
+    _entries = 0;
+    return true;
+}
+
+bool tello::video::SegmentWriter::append(const FrameHandle& frame, int64_t timestamp) {
+    if (std::fwrite(frame.data(), 1, frame.length(), _file) != frame.length()) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Cannot write video segment {}"),
+                               VideoRecorder::path(_directory, _drone, _session, _segment));
+        close();
+        return false;
+    }
+
+    if (_index != nullptr) {
+        const FrameInfo& info = frame.info();
+        VideoIndexRecord record{};
+        record._timestamp = timestamp;
+        record._offset = static_cast<uint64_t>(_segmentBytes);
+        record._length = static_cast<uint32_t>(frame.length());
+        record._nalType = static_cast<uint8_t>(info._nalType);
+        record._flags = (info._keyframe ? KEYFRAME : 0) | (info._parameterSets ? PARAMETER_SETS : 0) |
+                        (info._reference ? REFERENCE : 0);
+        if (info._keyframe) {
+            _keyframes.push_back(_entries);
+        }
+        _entries++;
+        if (std::fwrite(&record, sizeof(record), 1, _index) != 1) {
+            closeIndex();
+        }
+    }
+
+    _segmentBytes += static_cast<int64_t>(frame.length());
+    return true;
+}
+
+void tello::video::SegmentWriter::closeIndex() {
+    if (_index == nullptr) {
+        return;
+    }
+
+    VideoKeyframeTrailer trailer{};
+    trailer._keyframeCount = static_cast<uint32_t>(_keyframes.size());
+    std::memcpy(trailer._magic, VIDEO_KEYFRAME_MAGIC, sizeof(VIDEO_KEYFRAME_MAGIC));
+    std::fwrite(_keyframes.data(), sizeof(uint32_t), _keyframes.size(), _index);
+    std::fwrite(&trailer, sizeof(trailer), 1, _index);
+    std::fclose(_index);
+    _index = nullptr;
+}
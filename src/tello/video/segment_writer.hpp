@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <tello/video/frame_handle.hpp>
+#include <tello/video/video_recorder.hpp>
+
+#define VIDEO_WRITE_BUFFER_LENGTH (1024 * 1024)
+
+using std::string;
+using std::vector;
+using tello::FrameHandle;
+using tello::VideoSegmentPolicy;
+
+namespace tello::video {
+
+    /**
+     * Writes the frames of one drone into Annex-B segments, only used by the writer thread of the recorder.
+     * The frames are written through a large buffer, so the file gets few, big writes.
+     * Every segment gets a sidecar index with an entry per frame and a keyframe table.
+     */
+    class SegmentWriter {
+    public:
+        SegmentWriter(string directory, ip_address drone, uint64_t session, const VideoSegmentPolicy& policy);
+        SegmentWriter(const SegmentWriter&) = delete;
+        SegmentWriter& operator=(const SegmentWriter&) = delete;
+        ~SegmentWriter();
+
+        /**
+         * @return false, if the frame was not written, e.g. no keyframe started a segment yet
+         */
+        bool write(const FrameHandle& frame, int64_t timestamp);
+        void close();
+
+        /**
+         * @return number of segments opened so far
+         */
+        [[nodiscard]] unsigned int segments() const;
+
+    private:
+        const string _directory;
+        const ip_address _drone;
+        const uint64_t _session;
+        const VideoSegmentPolicy _policy;
+        std::FILE* _file;
+        std::FILE* _index;
+        vector<char> _buffer;
+        vector<uint32_t> _keyframes;
+        uint32_t _entries;
+        unsigned int _segment;
+        int64_t _segmentStart;
+        int64_t _segmentBytes;
+        FrameHandle _parameterSets;
+
+        bool open(int64_t timestamp);
+        bool append(const FrameHandle& frame, int64_t timestamp);
+        void closeIndex();
+    };
+}
@@ -0,0 +1,131 @@
+#include "start_code.hpp"
+
+#ifdef TELLO_START_CODE_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define TELLO_TARGET_AVX2
+#else
+#define TELLO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+using tello::video::start_code_finder;
+
+namespace {
+
+#ifdef TELLO_START_CODE_SIMD
+    inline unsigned int lowestBit(unsigned int mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+#endif
+
+    struct Scanner {
+        start_code_finder _finder;
+        const char* _name;
+    };
+
+    Scanner selectScanner() {
+#ifdef TELLO_START_CODE_SIMD
+        if (tello::video::supportsAvx2()) {
+            return Scanner{tello::video::findStartCodeAvx2, "avx2"};
+        }
+        return Scanner{tello::video::findStartCodeSse2, "sse2"};
+#else
+        return Scanner{tello::video::findStartCodeScalar, "scalar"};
+#endif
+    }
+
+    const Scanner& scanner() {
+        static const Scanner SELECTED = selectScanner();
+        return SELECTED;
+    }
+}
+
+size_t tello::video::findStartCode(const unsigned char* data, size_t from, size_t length) {
+    return scanner()._finder(data, from, length);
+}
+
+const char* tello::video::startCodeScanner() {
+    return scanner()._name;
+}
+
+size_t tello::video::findStartCodeScalar(const unsigned char* data, size_t from, size_t length) {
+    for (size_t i = from; i + 2 < length;) {
+        if (data[i + 2] > 1) {
+            i += 3;
+        } else if (data[i + 2] == 1 && data[i + 1] == 0 && data[i] == 0) {
+            return i;
+        } else {
+            i++;
+        }
+    }
+    return START_CODE_NOT_FOUND;
+}
+
+#ifdef TELLO_START_CODE_SIMD
+
+size_t tello::video::findStartCodeSse2(const unsigned char* data, size_t from, size_t length) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+
+    size_t i = from;
+    // bytes i, i + 1 and i + 2 are compared for 16 positions at once
+    for (; i + 18 <= length; i += 16) {
+        __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+        __m128i third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 2));
+        __m128i match = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(first, zero), _mm_cmpeq_epi8(second, zero)),
+                                      _mm_cmpeq_epi8(third, one));
+        auto mask = static_cast<unsigned int>(_mm_movemask_epi8(match));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+    return findStartCodeScalar(data, i, length);
+}
+
+TELLO_TARGET_AVX2
+size_t tello::video::findStartCodeAvx2(const unsigned char* data, size_t from, size_t length) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi8(1);
+
+    size_t i = from;
+    for (; i + 34 <= length; i += 32) {
+        __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 1));
+        __m256i third = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 2));
+        __m256i match = _mm256_and_si256(
+                _mm256_and_si256(_mm256_cmpeq_epi8(first, zero), _mm256_cmpeq_epi8(second, zero)),
+                _mm256_cmpeq_epi8(third, one));
+        auto mask = static_cast<unsigned int>(_mm256_movemask_epi8(match));
+        if (mask != 0) {
+            return i + lowestBit(mask);
+        }
+    }
+    return findStartCodeSse2(data, i, length);
+}
+
+bool tello::video::supportsAvx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+#define START_CODE_NOT_FOUND static_cast<size_t>(-1)
+
+// SSE2 is part of every x86-64 CPU, 32 bit x86 (e.g. a 32 bit MinGW build) uses the scalar scanner
+#if defined(__x86_64__) || defined(_M_X64)
+#define TELLO_START_CODE_SIMD
+#endif
+
+namespace tello::video {
+
+    using start_code_finder = size_t (*)(const unsigned char* data, size_t from, size_t length);
+
+    /**
+     * Position of the first '00 00 01' in data[from, length), START_CODE_NOT_FOUND otherwise.
+     * Uses the widest scanner the CPU supports (AVX2 or SSE2 on x86-64, scalar otherwise), selected on first use.
+     */
+    size_t findStartCode(const unsigned char* data, size_t from, size_t length);
+
+    size_t findStartCodeScalar(const unsigned char* data, size_t from, size_t length);
+#ifdef TELLO_START_CODE_SIMD
+    size_t findStartCodeSse2(const unsigned char* data, size_t from, size_t length);
+    size_t findStartCodeAvx2(const unsigned char* data, size_t from, size_t length);
+    bool supportsAvx2();
+#endif
+
+    /**
+     * Name of the scanner used by 'findStartCode'
+     */
+    const char* startCodeScanner();
+
+    /**
+     * First byte of the start code at 'position', including the leading zero of a 4 byte start code
+     */
+    inline size_t startCodeBegin(const unsigned char* data, size_t position) {
+        return position > 0 && data[position - 1] == 0 ? position - 1 : position;
+    }
+}
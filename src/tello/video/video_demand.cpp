@@ -0,0 +1,97 @@
+#include "video_demand.hpp"
+#include <tello/logger/logger_interface.hpp>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using std::chrono::steady_clock;
+
+tello::video::VideoDemand::VideoDemand(stream_switch streamSwitch)
+        : _streamSwitch(std::move(streamSwitch)), _mutex(), _changed(), _worker(), _wanted(true), _enabled(false),
+          _stopping(false), _streaming(false), _subscribers(0),
+          _streamoffDelay(0), _idleSince() {
+}
+
+tello::video::VideoDemand::~VideoDemand() {
+    disable();
+}
+
+void tello::video::VideoDemand::enable(std::chrono::milliseconds streamoffDelay) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    stop(lock);
+
+    _enabled = true;
+    _stopping = false;
+    _streaming = true;
+    _streamoffDelay = streamoffDelay;
+    _idleSince = steady_clock::now();
+    _wanted.store(_subscribers > 0, std::memory_order_release);
+    _worker = thread(&VideoDemand::run, this);
+}
+
+void tello::video::VideoDemand::disable() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    stop(lock);
+    _enabled = false;
+    _wanted.store(true, std::memory_order_release);
+}
+
+void tello::video::VideoDemand::stop(std::unique_lock<std::mutex>& lock) {
+    if (!_worker.joinable()) {
+        return;
+    }
+
+    _stopping = true;
+    _changed.notify_all();
+    lock.unlock();
+    _worker.join();
+    lock.lock();
+}
+
+void tello::video::VideoDemand::changed(int delta) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _subscribers += delta;
+    if (_subscribers == 0) {
+        _idleSince = steady_clock::now();
+    }
+    if (_enabled) {
+        _wanted.store(_subscribers > 0, std::memory_order_release);
+        _changed.notify_all();
+    }
+}
+
+bool tello::video::VideoDemand::wanted() const {
+    return _wanted.load(std::memory_order_acquire);
+}
+
+bool tello::video::VideoDemand::streaming() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _streaming;
+}
+
+void tello::video::VideoDemand::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stopping) {
+        bool streamon = _subscribers > 0 && !_streaming;
+        bool streamoff = _subscribers == 0 && _streaming && steady_clock::now() >= _idleSince + _streamoffDelay;
+        if (!streamon && !streamoff) {
+            if (_subscribers == 0 && _streaming) {
+                _changed.wait_until(lock, _idleSince + _streamoffDelay);
+            } else {
+                _changed.wait(lock);
+            }
+            continue;
+        }
+
+        lock.unlock();
+        bool switched = _streamSwitch(streamon);
+        lock.lock();
+        if (switched) {
+            _streaming = streamon;
+            LoggerInterface::info(LoggerType::VIDEO, string("Video stream switched {}"), streamon ? "on" : "off");
+        } else {
+            // the drone did not answer, back off instead of flooding it with commands, even without streamoff delay
+            LoggerInterface::warn(LoggerType::VIDEO, string("Video stream not switched {}"), streamon ? "on" : "off");
+            _changed.wait_for(lock, std::chrono::milliseconds(VIDEO_DEMAND_RETRY_MS), [this]() { return _stopping; });
+        }
+    }
+}
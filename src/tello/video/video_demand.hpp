@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#define VIDEO_DEMAND_RETRY_MS 500
+
+using std::thread;
+
+namespace tello::video {
+
+    /**
+     * Switches the video stream of one drone by the presence of its video subscribers.
+     * 'streamon' is sent as soon as the first subscriber appears, 'streamoff' only after the drone had
+     * no subscriber for the streamoff delay, so short gaps between subscribers do not toggle the stream.
+     * The commands are sent by a thread of its own, subscribing never waits for the drone.
+     * A command the drone does not acknowledge is retried every VIDEO_DEMAND_RETRY_MS.
+     */
+    class VideoDemand {
+    public:
+        /**
+         * @return true, if the drone acknowledged the command
+         */
+        using stream_switch = std::function<bool(bool streamon)>;
+
+        explicit VideoDemand(stream_switch streamSwitch);
+        VideoDemand(const VideoDemand&) = delete;
+        VideoDemand& operator=(const VideoDemand&) = delete;
+        ~VideoDemand();
+
+        /**
+         * The stream state of the drone is unknown, without subscribers it is switched off after the delay.
+         */
+        void enable(std::chrono::milliseconds streamoffDelay);
+        void disable();
+
+        /**
+         * @param delta +1 for a new subscriber, -1 for a removed one
+         */
+        void changed(int delta);
+
+        /**
+         * Lock-free check of the video listener: packets nobody wants are discarded before reassembly.
+         */
+        [[nodiscard]] bool wanted() const;
+        [[nodiscard]] bool streaming() const;
+
+    private:
+        stream_switch _streamSwitch;
+        mutable std::mutex _mutex;
+        std::condition_variable _changed;
+        thread _worker;
+        std::atomic<bool> _wanted;
+        bool _enabled;
+        bool _stopping;
+        bool _streaming;
+        long _subscribers;
+        std::chrono::milliseconds _streamoffDelay;
+        std::chrono::steady_clock::time_point _idleSince;
+
+        void run();
+        void stop(std::unique_lock<std::mutex>& lock);
+    };
+}
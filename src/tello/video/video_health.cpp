@@ -0,0 +1,94 @@
+#include <tello/video/video_health.hpp>
+#include <cmath>
+
+using tello::VideoHealthStatistics;
+
+tello::VideoHealth::VideoHealth() : _mutex(), _reassembly(), _window(), _next(0), _count(0), _frames(0), _keyframes(0),
+                                    _lastKeyframe(0), _keyframeInterval(0), _lastInterval(-1), _jitter(0.0) {
+}
+
+void tello::VideoHealth::reassembly(const VideoStatistics& statistics) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _reassembly = statistics;
+}
+
+void tello::VideoHealth::frame(size_t length, bool keyframe, int64_t firstPacket, int64_t complete) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_count > 0) {
+        const FrameSample& previous = _window[(_next + VIDEO_HEALTH_WINDOW - 1) % VIDEO_HEALTH_WINDOW];
+        int64_t interval = complete - previous._complete;
+        if (_lastInterval >= 0) {
+            _jitter += (std::abs(static_cast<double>(interval - _lastInterval)) - _jitter) / 16.0;
+        }
+        _lastInterval = interval;
+    }
+
+    _frames++;
+    if (keyframe) {
+        if (_keyframes > 0) {
+            _keyframeInterval = _frames - _lastKeyframe;
+        }
+        _lastKeyframe = _frames;
+        _keyframes++;
+    }
+
+    _window[_next] = FrameSample{complete, length, complete - firstPacket};
+    _next = (_next + 1) % VIDEO_HEALTH_WINDOW;
+    if (_count < VIDEO_HEALTH_WINDOW) {
+        _count++;
+    }
+}
+
+void tello::VideoHealth::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _reassembly = VideoStatistics();
+    _next = 0;
+    _count = 0;
+    _frames = 0;
+    _keyframes = 0;
+    _lastKeyframe = 0;
+    _keyframeInterval = 0;
+    _lastInterval = -1;
+    _jitter = 0.0;
+}
+
+VideoHealthStatistics tello::VideoHealth::statistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    VideoHealthStatistics statistics;
+    statistics._packets = _reassembly._packets;
+    statistics._bytes = _reassembly._bytesReceived;
+    statistics._frames = _reassembly._framesDelivered;
+    statistics._keyframes = _keyframes;
+    statistics._framesDropped = _reassembly._framesDropped;
+    statistics._lossEvents = _reassembly._lossEvents;
+    statistics._corruptFrames = _reassembly._corruptFrames;
+    statistics._staleFrames = _reassembly._staleFrames;
+    statistics._oversizeFrames = _reassembly._oversizeFrames;
+    statistics._jitter = _jitter;
+    statistics._keyframeInterval = _keyframeInterval;
+    if (_count == 0) {
+        return statistics;
+    }
+
+    size_t oldest = (_next + VIDEO_HEALTH_WINDOW - _count) % VIDEO_HEALTH_WINDOW;
+    size_t newest = (_next + VIDEO_HEALTH_WINDOW - 1) % VIDEO_HEALTH_WINDOW;
+    uint64_t bytes = 0;
+    int64_t latency = 0;
+    for (size_t i = 0; i < _count; i++) {
+        const FrameSample& sample = _window[(oldest + i) % VIDEO_HEALTH_WINDOW];
+        latency += sample._latency;
+        // the first frame only opens the measured span
+        if (i > 0) {
+            bytes += sample._length;
+        }
+    }
+    statistics._reassemblyLatency = latency / static_cast<int64_t>(_count);
+    statistics._lastFrame = _window[newest]._complete;
+
+    int64_t span = _window[newest]._complete - _window[oldest]._complete;
+    if (span > 0) {
+        statistics._fps = static_cast<double>(_count - 1) * 1000000.0 / static_cast<double>(span);
+        statistics._bitrate = static_cast<double>(bytes) * 8.0 * 1000000.0 / static_cast<double>(span);
+    }
+    return statistics;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#define VIDEO_INDEX_VERSION 1
+
+namespace tello::video {
+
+    constexpr char VIDEO_INDEX_MAGIC[4] = {'T', 'V', 'I', 'X'};
+    constexpr char VIDEO_KEYFRAME_MAGIC[4] = {'T', 'V', 'K', 'F'};
+
+    /**
+     * Layout of the sidecar index of a video segment:
+     * | header | entry 0 | entry 1 | ... | keyframe table | trailer |
+     * An entry is appended per access unit. The keyframe table (entry numbers of the keyframes) and
+     * the trailer are written, when the segment is closed. Without trailer the keyframes are found by a scan.
+     */
+    struct VideoIndexHeader {
+        char _magic[4];
+        uint32_t _version;
+        uint64_t _drone;
+        uint32_t _segment;
+        uint32_t _entrySize;
+    };
+
+    enum VideoIndexFlags : uint8_t {
+        KEYFRAME = 1,
+        PARAMETER_SETS = 2,
+        REFERENCE = 4
+    };
+
+    struct VideoIndexRecord {
+        int64_t _timestamp;
+        uint64_t _offset;
+        uint32_t _length;
+        uint8_t _nalType;
+        uint8_t _flags;
+        uint16_t _reserved;
+    };
+
+    struct VideoKeyframeTrailer {
+        uint32_t _keyframeCount;
+        char _magic[4];
+    };
+}
@@ -0,0 +1,84 @@
+#include <tello/video/video_queue.hpp>
+
+using tello::FrameHandle;
+using tello::VideoDropPolicy;
+using tello::VideoQueueStatistics;
+
+tello::VideoQueue::VideoQueue(size_t capacity, VideoDropPolicy policy)
+        : _mutex(), _frames(), _capacity(capacity > 0 ? capacity : 1), _policy(policy), _draining(false),
+          _waitForKeyframe(false), _statistics() {
+}
+
+void tello::VideoQueue::configure(size_t capacity, VideoDropPolicy policy) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity > 0 ? capacity : 1;
+    _policy = policy;
+    _waitForKeyframe = false;
+    while (_frames.size() > _capacity) {
+        _frames.pop_front();
+        _statistics._dropped++;
+    }
+}
+
+bool tello::VideoQueue::push(FrameHandle&& frame) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _statistics._enqueued++;
+
+    bool keyframe = frame.info()._keyframe;
+    if (_policy == VideoDropPolicy::LATEST_GOP) {
+        if (keyframe) {
+            _statistics._dropped += _frames.size();
+            _frames.clear();
+            _waitForKeyframe = false;
+        } else if (_waitForKeyframe || _frames.size() >= _capacity) {
+            _statistics._dropped++;
+            _waitForKeyframe = true;
+            return false;
+        }
+    } else if (_frames.size() >= _capacity) {
+        dropFull();
+    }
+
+    _frames.push_back(std::move(frame));
+    if (_frames.size() > _statistics._maxDepth) {
+        _statistics._maxDepth = _frames.size();
+    }
+
+    bool idle = !_draining;
+    _draining = true;
+    return idle;
+}
+
+FrameHandle tello::VideoQueue::pop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_frames.empty()) {
+        _draining = false;
+        return FrameHandle{};
+    }
+
+    FrameHandle frame = std::move(_frames.front());
+    _frames.pop_front();
+    _statistics._delivered++;
+    return frame;
+}
+
+VideoQueueStatistics tello::VideoQueue::statistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    VideoQueueStatistics statistics = _statistics;
+    statistics._depth = _frames.size();
+    return statistics;
+}
+
+void tello::VideoQueue::dropFull() {
+    auto dropped = _frames.begin();
+    if (_policy == VideoDropPolicy::DROP_NON_REFERENCE) {
+        for (auto it = _frames.begin(); it != _frames.end(); ++it) {
+            if (!it->info()._reference) {
+                dropped = it;
+                break;
+            }
+        }
+    }
+    _frames.erase(dropped);
+    _statistics._dropped++;
+}
@@ -0,0 +1,228 @@
+#include <tello/video/video_reader.hpp>
+#include <tello/video/video_recorder.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "video_index_format.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::MemoryMapInterface;
+using tello::VideoIndexEntry;
+using tello::video::VideoIndexHeader;
+using tello::video::VideoIndexRecord;
+using tello::video::VideoKeyframeTrailer;
+
+namespace tello {
+
+    struct VideoReader::Segment {
+        unique_ptr<MemoryMapInterface> _video;
+        unique_ptr<MemoryMapInterface> _index;
+        unsigned int _number;
+        size_t _firstFrame;
+        size_t _frameCount;
+
+        [[nodiscard]] const VideoIndexRecord& record(size_t frame) const {
+            return reinterpret_cast<const VideoIndexRecord*>(_index->data() + sizeof(VideoIndexHeader))[frame];
+        }
+    };
+}
+
+tello::VideoReader::VideoReader() : _segments(), _keyframes(), _frameCount(0) {
+}
+
+tello::VideoReader::~VideoReader() {
+    close();
+}
+
+bool tello::VideoReader::open(const string& directory, ip_address drone, uint64_t session) {
+    close();
+    for (unsigned int number = 1; openSegment(directory, drone, session, number); number++) {
+    }
+    return !_segments.empty();
+}
+
+bool tello::VideoReader::open(const string& directory, ip_address drone) {
+    vector<uint64_t> recorded = sessions(directory, drone);
+    if (recorded.empty()) {
+        close();
+        return false;
+    }
+    return open(directory, drone, recorded.back());
+}
+
+vector<uint64_t> tello::VideoReader::sessions(const string& directory, ip_address drone) {
+    // 'video_<ip>_<session>_000001.h264', the first segment of every session
+    string pattern = std::filesystem::path(VideoRecorder::path(directory, drone, 0, 1)).filename().string();
+    size_t session = pattern.rfind("_0_");
+    string prefix = pattern.substr(0, session + 1);
+    string suffix = pattern.substr(session + 2);
+
+    vector<uint64_t> sessions;
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(directory, error)) {
+        string name = file.path().filename().string();
+        if (name.size() <= prefix.size() + suffix.size() || name.compare(0, prefix.size(), prefix) != 0 ||
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        string number = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+        if (std::all_of(number.begin(), number.end(), [](char c) { return std::isdigit(c) != 0; })) {
+            sessions.push_back(std::stoull(number));
+        }
+    }
+    std::sort(sessions.begin(), sessions.end());
+    return sessions;
+}
+
+void tello::VideoReader::close() {
+    for (auto& segment : _segments) {
+        segment->_video->close();
+        segment->_index->close();
+    }
+    _segments.clear();
+    _keyframes.clear();
+    _frameCount = 0;
+}
+
+size_t tello::VideoReader::segmentCount() const {
+    return _segments.size();
+}
+
+size_t tello::VideoReader::frameCount() const {
+    return _frameCount;
+}
+
+size_t tello::VideoReader::keyframeCount() const {
+    return _keyframes.size();
+}
+
+VideoIndexEntry tello::VideoReader::entry(size_t frame) const {
+    const Segment& segment = segmentOf(frame);
+    const VideoIndexRecord& record = segment.record(frame - segment._firstFrame);
+    VideoIndexEntry entry;
+    entry._timestamp = record._timestamp;
+    entry._segment = segment._number;
+    entry._offset = record._offset;
+    entry._length = record._length;
+    entry._type = static_cast<NalUnitType>(record._nalType);
+    entry._keyframe = (record._flags & video::KEYFRAME) != 0;
+    entry._parameterSets = (record._flags & video::PARAMETER_SETS) != 0;
+    return entry;
+}
+
+optional<size_t> tello::VideoReader::seek(int64_t timestamp) const {
+    auto after = std::upper_bound(_keyframes.begin(), _keyframes.end(), timestamp,
+                                  [this](int64_t time, size_t keyframe) {
+                                      return time < entry(keyframe)._timestamp;
+                                  });
+    if (after == _keyframes.begin()) {
+        return std::nullopt;
+    }
+
+    size_t keyframe = *(after - 1);
+    const Segment& segment = segmentOf(keyframe);
+    if (!entry(keyframe)._parameterSets && keyframe > segment._firstFrame) {
+        VideoIndexEntry previous = entry(keyframe - 1);
+        if (previous._parameterSets && !previous._keyframe) {
+            return keyframe - 1;
+        }
+    }
+    return keyframe;
+}
+
+const unsigned char* tello::VideoReader::frame(size_t frame, size_t& length) const {
+    const Segment& segment = segmentOf(frame);
+    const VideoIndexRecord& record = segment.record(frame - segment._firstFrame);
+    length = record._length;
+    return reinterpret_cast<const unsigned char*>(segment._video->data()) + record._offset;
+}
+
+bool tello::VideoReader::openSegment(const string& directory, ip_address drone, uint64_t session,
+                                     unsigned int number) {
+    auto segment = std::make_unique<Segment>();
+    segment->_video = MemoryMapFactory::build();
+    segment->_index = MemoryMapFactory::build();
+    segment->_number = number;
+    segment->_firstFrame = _frameCount;
+
+    string indexPath = VideoRecorder::indexPath(directory, drone, session, number);
+    if (!segment->_index->open(indexPath, 0, false)) {
+        return false;
+    }
+    if (!segment->_video->open(VideoRecorder::path(directory, drone, session, number), 0, false)) {
+        segment->_index->close();
+        return false;
+    }
+
+    size_t indexSize = segment->_index->size();
+    const auto* header = reinterpret_cast<const VideoIndexHeader*>(segment->_index->data());
+    bool valid = indexSize >= sizeof(VideoIndexHeader) &&
+                 std::memcmp(header->_magic, video::VIDEO_INDEX_MAGIC, sizeof(video::VIDEO_INDEX_MAGIC)) == 0 &&
+                 header->_version == VIDEO_INDEX_VERSION && header->_entrySize == sizeof(VideoIndexRecord) &&
+                 header->_drone == drone;
+    if (!valid) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Video index {} has an incompatible format"), indexPath);
+        segment->_video->close();
+        segment->_index->close();
+        return false;
+    }
+
+    // a closed segment ends with its keyframe table, an interrupted recording is scanned for keyframes
+    size_t entriesSize = indexSize - sizeof(VideoIndexHeader);
+    const char* end = segment->_index->data() + indexSize;
+    const VideoKeyframeTrailer* trailer = nullptr;
+    if (entriesSize >= sizeof(VideoKeyframeTrailer)) {
+        const auto* candidate = reinterpret_cast<const VideoKeyframeTrailer*>(end - sizeof(VideoKeyframeTrailer));
+        size_t tableSize = candidate->_keyframeCount * sizeof(uint32_t) + sizeof(VideoKeyframeTrailer);
+        if (std::memcmp(candidate->_magic, video::VIDEO_KEYFRAME_MAGIC, sizeof(video::VIDEO_KEYFRAME_MAGIC)) == 0 &&
+            tableSize <= entriesSize) {
+            trailer = candidate;
+            entriesSize -= tableSize;
+        }
+    }
+    segment->_frameCount = entriesSize / sizeof(VideoIndexRecord);
+
+    // frames not completely written are ignored
+    size_t videoSize = segment->_video->size();
+    while (segment->_frameCount > 0) {
+        const VideoIndexRecord& last = segment->record(segment->_frameCount - 1);
+        if (last._offset + last._length <= videoSize) {
+            break;
+        }
+        segment->_frameCount--;
+    }
+
+    if (trailer != nullptr) {
+        const auto* table = reinterpret_cast<const uint32_t*>(reinterpret_cast<const char*>(trailer) -
+                                                              trailer->_keyframeCount * sizeof(uint32_t));
+        for (uint32_t i = 0; i < trailer->_keyframeCount; i++) {
+            if (table[i] < segment->_frameCount) {
+                _keyframes.push_back(segment->_firstFrame + table[i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < segment->_frameCount; i++) {
+            if ((segment->record(i)._flags & video::KEYFRAME) != 0) {
+                _keyframes.push_back(segment->_firstFrame + i);
+            }
+        }
+    }
+
+    _frameCount += segment->_frameCount;
+    _segments.push_back(std::move(segment));
+    return true;
+}
+
+const tello::VideoReader::Segment& tello::VideoReader::segmentOf(size_t frame) const {
+    auto after = std::upper_bound(_segments.begin(), _segments.end(), frame,
+                                  [](size_t number, const unique_ptr<Segment>& segment) {
+                                      return number < segment->_firstFrame;
+                                  });
+    return **(after - 1);
+}
@@ -0,0 +1,155 @@
+#include <tello/video/video_recorder.hpp>
+#include "segment_writer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#define VIDEO_WRITE_INTERVAL_MS 100
+
+using tello::video::SegmentWriter;
+
+namespace {
+
+    /**
+     * Start time of a new recorder, later than every session started before by this process
+     */
+    uint64_t nextSession() {
+        static std::atomic<uint64_t> last{0};
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        auto session = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+        uint64_t previous = last.load();
+        while (!last.compare_exchange_weak(previous, std::max(session, previous + 1))) {
+        }
+        return std::max(session, previous + 1);
+    }
+}
+
+tello::VideoRecorder::VideoRecorder(string directory, const VideoSegmentPolicy& policy)
+        : _directory(std::move(directory)),
+          _policy(policy),
+          _session(nextSession()),
+          _pending(),
+          _pendingMutex(),
+          _pendingCondition(),
+          _running(true),
+          _capacity(VIDEO_RECORDER_QUEUE_CAPACITY),
+          _writing(0),
+          _recorded(0),
+          _dropped(0),
+          _segments(0),
+          _writers(),
+          _worker() {
+    _pending.reserve(VIDEO_RECORDER_QUEUE_CAPACITY);
+    _worker = thread(static_cast<void (VideoRecorder::*)()>(&VideoRecorder::write), this);
+}
+
+tello::VideoRecorder::~VideoRecorder() {
+    stop();
+}
+
+bool tello::VideoRecorder::record(ip_address drone, const FrameHandle& frame, int64_t timestamp) {
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    if (!_running || _pending.size() + _writing >= _capacity) {
+        _dropped++;
+        return false;
+    }
+    _pending.push_back(PendingFrame{drone, timestamp, frame});
+    return true;
+}
+
+void tello::VideoRecorder::limit(size_t maxFrames) {
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    _capacity = std::min(maxFrames, (size_t) VIDEO_RECORDER_QUEUE_CAPACITY);
+}
+
+void tello::VideoRecorder::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _pendingCondition.notify_one();
+    _worker.join();
+    _writers.clear();
+}
+
+unsigned long long tello::VideoRecorder::recorded() const {
+    return _recorded;
+}
+
+unsigned long long tello::VideoRecorder::dropped() const {
+    return _dropped;
+}
+
+unsigned long long tello::VideoRecorder::segments() const {
+    return _segments;
+}
+
+uint64_t tello::VideoRecorder::session() const {
+    return _session;
+}
+
+string tello::VideoRecorder::path(const string& directory, ip_address drone, uint64_t session, unsigned int segment) {
+    return segmentName(directory, drone, session, segment) + ".h264";
+}
+
+string tello::VideoRecorder::indexPath(const string& directory, ip_address drone, uint64_t session,
+                                       unsigned int segment) {
+    return segmentName(directory, drone, session, segment) + ".tvix";
+}
+
+string tello::VideoRecorder::segmentName(const string& directory, ip_address drone, uint64_t session,
+                                         unsigned int segment) {
+    char number[16];
+    std::snprintf(number, sizeof(number), "%06u", segment);
+    return directory + "/video_" + std::to_string((drone >> 24) & 0xFF) + "." +
+           std::to_string((drone >> 16) & 0xFF) + "." + std::to_string((drone >> 8) & 0xFF) + "." +
+           std::to_string(drone & 0xFF) + "_" + std::to_string(session) + "_" + number;
+}
+
+void tello::VideoRecorder::write() {
+    vector<PendingFrame> frames;
+    frames.reserve(VIDEO_RECORDER_QUEUE_CAPACITY);
+    bool running = true;
+
+    while (running) {
+        {
+            std::unique_lock<std::mutex> lock(_pendingMutex);
+            _pendingCondition.wait_for(lock, std::chrono::milliseconds(VIDEO_WRITE_INTERVAL_MS));
+            // Swap instead of copy, the listener keeps a preallocated buffer.
+            frames.swap(_pending);
+            _writing = frames.size();
+            running = _running;
+        }
+
+        write(frames);
+        // drops the handles, the buffers go back to their pool
+        frames.clear();
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        _writing = 0;
+    }
+
+    for (auto& writer : _writers) {
+        writer.second->close();
+    }
+}
+
+void tello::VideoRecorder::write(vector<PendingFrame>& frames) {
+    for (const auto& pending : frames) {
+        auto writer = _writers.find(pending._drone);
+        if (writer == _writers.end()) {
+            writer = _writers.emplace(pending._drone,
+                                      std::make_unique<SegmentWriter>(_directory, pending._drone, _session, _policy)).first;
+        }
+
+        unsigned int segments = writer->second->segments();
+        if (writer->second->write(pending._frame, pending._timestamp)) {
+            _recorded++;
+        } else {
+            _dropped++;
+        }
+        _segments += writer->second->segments() - segments;
+    }
+}
@@ -0,0 +1,198 @@
+#include <tello/video/video_ring.hpp>
+#include <tello/logger/logger_interface.hpp>
+#include "video_ring_format.hpp"
+#include "../native/memory_map_interface.hpp"
+#include "../native/memory_map_factory.hpp"
+#include "../native/address_wait_interface.hpp"
+#include "../native/address_wait_factory.hpp"
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#define VIDEO_RING_POLL_US 200
+
+using tello::AddressWaitFactory;
+using tello::LoggerInterface;
+using tello::LoggerType;
+using tello::MemoryMapFactory;
+using tello::MemoryMapInterface;
+using tello::VideoRingFrame;
+using tello::video::VideoRingHeader;
+using tello::video::VideoRingSlot;
+
+namespace {
+
+    VideoRingSlot* slotOf(char* ring, uint64_t sequence) {
+        const auto* header = reinterpret_cast<const VideoRingHeader*>(ring);
+        size_t index = (sequence - 1) % header->_slotCount;
+        return reinterpret_cast<VideoRingSlot*>(ring + tello::video::videoRingHeaderSize() +
+                                                index * tello::video::videoRingSlotSize(header->_slotCapacity));
+    }
+
+    unsigned char* slotData(VideoRingSlot* slot) {
+        return reinterpret_cast<unsigned char*>(slot) + tello::video::alignRing(sizeof(VideoRingSlot));
+    }
+}
+
+tello::VideoRingPublisher::VideoRingPublisher(string directory, uint32_t slots, uint64_t slotCapacity)
+        : _directory(std::move(directory)), _slots(slots > 0 ? slots : 1), _slotCapacity(slotCapacity), _mutex(),
+          _wait(AddressWaitFactory::build()), _rings(), _published(0), _dropped(0) {
+}
+
+tello::VideoRingPublisher::~VideoRingPublisher() {
+    for (auto& ring : _rings) {
+        if (ring.second != nullptr) {
+            ring.second->close();
+        }
+    }
+}
+
+bool tello::VideoRingPublisher::publish(ip_address drone, const FrameHandle& frame, int64_t timestamp) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    MemoryMapInterface* ring = ringOf(drone);
+    if (ring == nullptr || frame.length() > _slotCapacity) {
+        _dropped++;
+        return false;
+    }
+
+    auto* header = reinterpret_cast<VideoRingHeader*>(ring->data());
+    uint64_t sequence = header->_published.load(std::memory_order_relaxed) + 1;
+    VideoRingSlot* slot = slotOf(ring->data(), sequence);
+
+    slot->_version.store(sequence * 2 - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(slotData(slot), frame.data(), frame.length());
+    slot->_timestamp = timestamp;
+    slot->_length = static_cast<uint32_t>(frame.length());
+    slot->_keyframe = frame.info()._keyframe ? 1 : 0;
+    slot->_version.store(sequence * 2, std::memory_order_release);
+    header->_published.store(sequence, std::memory_order_release);
+    header->_signal.store(static_cast<uint32_t>(sequence), std::memory_order_release);
+    _wait->wake(header->_signal);
+
+    _published++;
+    return true;
+}
+
+unsigned long long tello::VideoRingPublisher::published() const {
+    return _published;
+}
+
+unsigned long long tello::VideoRingPublisher::dropped() const {
+    return _dropped;
+}
+
+string tello::VideoRingPublisher::path(const string& directory, ip_address drone) {
+    return directory + "/video_" + std::to_string((drone >> 24) & 0xFF) + "." +
+           std::to_string((drone >> 16) & 0xFF) + "." + std::to_string((drone >> 8) & 0xFF) + "." +
+           std::to_string(drone & 0xFF) + ".tvring";
+}
+
+MemoryMapInterface* tello::VideoRingPublisher::ringOf(ip_address drone) {
+    auto found = _rings.find(drone);
+    if (found != _rings.end()) {
+        return found->second.get();
+    }
+
+    unique_ptr<MemoryMapInterface> ring = MemoryMapFactory::build();
+    string ringPath = path(_directory, drone);
+    if (!ring->open(ringPath, video::videoRingSize(_slots, _slotCapacity), true)) {
+        LoggerInterface::error(LoggerType::VIDEO, string("Cannot map video ring {}"), ringPath);
+        // Remember the failure, so the file is not reopened for every frame.
+        ring = nullptr;
+    } else {
+        // a new session, readers of an old one see no frames
+        std::memset(ring->data(), 0, video::videoRingHeaderSize());
+        auto* header = reinterpret_cast<VideoRingHeader*>(ring->data());
+        header->_version = VIDEO_RING_VERSION;
+        header->_slotCount = _slots;
+        header->_drone = drone;
+        header->_slotCapacity = _slotCapacity;
+        for (uint64_t sequence = 1; sequence <= _slots; sequence++) {
+            slotOf(ring->data(), sequence)->_version.store(0, std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(header->_magic, video::VIDEO_RING_MAGIC, sizeof(video::VIDEO_RING_MAGIC));
+    }
+    return _rings.emplace(drone, std::move(ring)).first->second.get();
+}
+
+tello::VideoRingReader::VideoRingReader() : _map(MemoryMapFactory::build()), _wait(AddressWaitFactory::build()) {
+}
+
+tello::VideoRingReader::~VideoRingReader() {
+    close();
+}
+
+bool tello::VideoRingReader::open(const string& directory, ip_address drone) {
+    if (!_map->open(VideoRingPublisher::path(directory, drone), 0, false)) {
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const VideoRingHeader*>(_map->data());
+    bool valid = _map->size() >= video::videoRingHeaderSize() &&
+                 std::memcmp(header->_magic, video::VIDEO_RING_MAGIC, sizeof(video::VIDEO_RING_MAGIC)) == 0 &&
+                 header->_version == VIDEO_RING_VERSION && header->_drone == drone && header->_slotCount > 0 &&
+                 _map->size() >= video::videoRingSize(header->_slotCount, header->_slotCapacity);
+    if (!valid) {
+        _map->close();
+        return false;
+    }
+    return true;
+}
+
+void tello::VideoRingReader::close() {
+    _map->close();
+}
+
+uint64_t tello::VideoRingReader::latest() const {
+    if (_map->data() == nullptr) {
+        return 0;
+    }
+    return reinterpret_cast<const VideoRingHeader*>(_map->data())->_published.load(std::memory_order_acquire);
+}
+
+optional<VideoRingFrame> tello::VideoRingReader::frame(uint64_t sequence) const {
+    if (sequence == 0 || sequence > latest()) {
+        return std::nullopt;
+    }
+
+    VideoRingSlot* slot = slotOf(_map->data(), sequence);
+    if (slot->_version.load(std::memory_order_acquire) != sequence * 2) {
+        return std::nullopt;
+    }
+
+    VideoRingFrame frame{sequence, slot->_timestamp, slot->_keyframe != 0, slotData(slot), slot->_length};
+    if (!valid(frame)) {
+        return std::nullopt;
+    }
+    return frame;
+}
+
+bool tello::VideoRingReader::valid(const VideoRingFrame& frame) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slotOf(_map->data(), frame._sequence)->_version.load(std::memory_order_relaxed) == frame._sequence * 2;
+}
+
+bool tello::VideoRingReader::waitFor(uint64_t sequence, int64_t timeout) const {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout);
+    while (latest() < sequence) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return false;
+        }
+        if (!_wait->supported() || _map->data() == nullptr) {
+            std::this_thread::sleep_for(std::chrono::microseconds(VIDEO_RING_POLL_US));
+            continue;
+        }
+
+        // read before 'latest': a frame published in between changes the signal and the futex returns at once
+        auto& signal = reinterpret_cast<const VideoRingHeader*>(_map->data())->_signal;
+        uint32_t published = signal.load(std::memory_order_acquire);
+        if (latest() < sequence) {
+            _wait->wait(signal, published,
+                        std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count());
+        }
+    }
+    return true;
+}
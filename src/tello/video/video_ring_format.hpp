@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#define VIDEO_RING_VERSION 2
+#define VIDEO_RING_ALIGNMENT 64
+
+namespace tello::video {
+
+    constexpr char VIDEO_RING_MAGIC[8] = {'T', 'V', 'R', 'I', 'N', 'G', '0', '1'};
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the ring is shared between processes");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "the ring is shared between processes");
+
+    /**
+     * Layout of the shared video ring of a drone:
+     * | header | slot 0 | slot 1 | ... |
+     * Frame n (starting with 1) is written into slot (n - 1) % slotCount. The version of a slot is odd
+     * while the publisher writes it and 2n once frame n is complete (seqlock), so readers detect overwritten frames.
+     * '_signal' holds the low 32 bits of '_published', readers sleep on it (futex) until the next frame.
+     */
+    struct VideoRingHeader {
+        char _magic[8];
+        uint32_t _version;
+        uint32_t _slotCount;
+        uint64_t _drone;
+        uint64_t _slotCapacity;
+        std::atomic<uint64_t> _published;
+        std::atomic<uint32_t> _signal;
+    };
+
+    struct VideoRingSlot {
+        std::atomic<uint64_t> _version;
+        int64_t _timestamp;
+        uint32_t _length;
+        uint32_t _keyframe;
+    };
+
+    constexpr size_t alignRing(size_t size) {
+        return (size + VIDEO_RING_ALIGNMENT - 1) & ~static_cast<size_t>(VIDEO_RING_ALIGNMENT - 1);
+    }
+
+    constexpr size_t videoRingHeaderSize() {
+        return alignRing(sizeof(VideoRingHeader));
+    }
+
+    constexpr size_t videoRingSlotSize(uint64_t capacity) {
+        return alignRing(sizeof(VideoRingSlot)) + alignRing(capacity);
+    }
+
+    constexpr size_t videoRingSize(uint32_t slotCount, uint64_t capacity) {
+        return videoRingHeaderSize() + slotCount * videoRingSlotSize(capacity);
+    }
+}
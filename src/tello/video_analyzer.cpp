@@ -1,65 +1,344 @@
 #include "tello/video_analyzer.hpp"
-#include "tello/logger/logger_interface.hpp"
-#include <tello/native/network_interface.hpp>
-#include <string>
+#include <tello/video/frame_buffer.hpp>
+#include "video/frame_pool.hpp"
+#include "video/access_unit_parser.hpp"
+#include "video/start_code.hpp"
+#include <cstring>
 
 #define VIDEO_PACKET_LENGTH 1460
+#define VIDEO_RECEIVE_LENGTH 2048
 
-using std::string;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::VideoStatistics;
+using tello::video::FramePool;
+using tello::video::AccessUnitParser;
+using tello::NalUnitSink;
+using tello::NalUnitType;
+using tello::FrameInfo;
 
-tello::VideoAnalyzer::VideoAnalyzer() : _frames() {
+namespace tello {
 
+    struct DroneStream : public video::NalUnitListener {
+        DroneStream(ip_address address, FrameBuffer* frame, NalUnitSink* nalUnitSink)
+                : _address(address), _nalUnitSink(nalUnitSink), _frame(frame), _parser(nalUnitSink ? this : nullptr),
+                  _complete(0), _flush(false), _packetStart(0), _lastPacket(0), _frameStart(0),
+                  _corrupt(false),
+                  _waitForKeyframe(true), _skipping(false), _sequence(0), _statistics() {
+        }
+
+        void nalUnit(const unsigned char* frame, size_t begin, size_t end, bool lastInFrame) override {
+            size_t header = frame[begin + 2] == 1 ? begin + 3 : begin + 4;
+            NalUnitType type = nalUnitType(frame[header]);
+            bool decodable = !_waitForKeyframe || _parser.info()._keyframe || type == NalUnitType::SPS ||
+                             type == NalUnitType::PPS || type == NalUnitType::IDR_SLICE;
+            if (decodable) {
+                _nalUnitSink->nalUnit(_address, frame + begin, end - begin, lastInFrame, _lastPacket);
+            }
+        }
+
+        const ip_address _address;
+        NalUnitSink* const _nalUnitSink;
+        FrameBuffer* _frame;
+        AccessUnitParser _parser;
+        /**
+         * End of the complete access unit inside '_frame', 0 while incomplete
+         */
+        size_t _complete;
+        /**
+         * The last packet was short, the frame is complete once it holds a picture
+         */
+        bool _flush;
+        /**
+         * Offset of the last packet inside '_frame'
+         */
+        size_t _packetStart;
+        int64_t _lastPacket;
+        /**
+         * Receive time of the first packet of '_frame'
+         */
+        int64_t _frameStart;
+        /**
+         * The complete access unit lacks data
+         */
+        bool _corrupt;
+        bool _waitForKeyframe;
+        /**
+         * Packets are skipped until the next start code
+         */
+        bool _skipping;
+        uint64_t _sequence;
+        VideoStatistics _statistics;
+    };
+}
+
+tello::VideoAnalyzer::VideoAnalyzer() : VideoAnalyzer(std::make_shared<FramePool>()) {
+}
+
+tello::VideoAnalyzer::VideoAnalyzer(shared_ptr<video::FramePool> pool, const VideoLimits& limits,
+                                    NalUnitSink* nalUnitSink)
+        : _pool(std::move(pool)), _limits(limits), _nalUnitSink(nalUnitSink), _streams(),
+          _scratch(std::make_unique<FrameBuffer>(VIDEO_RECEIVE_LENGTH)) {
 }
 
 tello::VideoAnalyzer::~VideoAnalyzer() {
-    _frames.clear();
+    for (auto& stream : _streams) {
+        _pool->release(stream.second->_frame);
+    }
+    _streams.clear();
 }
 
-bool tello::VideoAnalyzer::isStart(const char* const& framePart, int length) {
-    return length >= 4 && framePart[0] == '\0' && framePart[1] == '\0' && framePart[2] == '\0' && framePart[3] == '\1';
+unsigned char* tello::VideoAnalyzer::receiveBuffer(ip_address address, size_t& available) {
+    FrameBuffer* frame = bufferOf(address);
+    if (frame != _scratch.get()) {
+        makeRoom(*_streams[address], VIDEO_RECEIVE_LENGTH);
+    }
+    available = frame->available();
+    return frame->tail();
 }
 
-bool tello::VideoAnalyzer::append(NetworkResponse& response) {
-    if(_frames.find(response._sender._ip) == _frames.end()) {
-        _frames[response._sender._ip] = std::make_shared<vector<NetworkResponse>>();
+bool tello::VideoAnalyzer::commit(ip_address expected, ip_address sender, size_t length, int64_t now) {
+    FrameBuffer* received = bufferOf(expected);
+    DroneStream& stream = streamOf(sender);
+    if (!attach(stream)) {
+        // no buffer in real-time mode, the stream resumes at the next start code
+        stream._lastPacket = now;
+        stream._statistics._packets++;
+        stream._statistics._bytesReceived += length;
+        stream._statistics._bytesDropped += length;
+        stream._statistics._poolExhausted++;
+        stream._waitForKeyframe = true;
+        return false;
+    }
+
+    FrameBuffer* frame = stream._frame;
+    if (frame != received) {
+        makeRoom(stream, length);
+        std::memcpy(frame->tail(), received->tail(), length);
     }
 
-    auto frames = _frames.find(response._sender._ip);
+    if (frame->length() > 0 && now - stream._lastPacket > _limits._staleTimeout) {
+        const unsigned char* packet = frame->tail();
+        stream._statistics._staleFrames++;
+        discard(stream);
+        std::memmove(frame->tail(), packet, length);
+    }
+    stream._lastPacket = now;
+    stream._statistics._packets++;
+    stream._statistics._bytesReceived += length;
 
-    if(frames->second->empty() && !isStart(response._response, response._length)) {
+    size_t packetLength = length;
+    if (frame->length() == 0) {
+        // a frame has to begin with a start code, bytes before it belong to a frame with a lost start
+        size_t position = video::findStartCode(frame->tail(), 0, length);
+        size_t begin = position == START_CODE_NOT_FOUND ? length : video::startCodeBegin(frame->tail(), position);
+        if (begin > 0) {
+            if (!stream._skipping) {
+                stream._statistics._lossEvents++;
+            }
+            stream._statistics._bytesDropped += begin;
+            stream._waitForKeyframe = true;
+        }
+        stream._skipping = begin == length;
+        if (stream._skipping) {
+            return false;
+        }
+        std::memmove(frame->tail(), frame->tail() + begin, length - begin);
+        length -= begin;
+    }
+
+    if (frame->length() + length > _limits._maxFrameLength) {
+        stream._statistics._oversizeFrames++;
+        stream._statistics._bytesDropped += length;
+        discard(stream);
         return false;
     }
 
-    int length = response._length;
-    frames->second->push_back(std::move(response));
+    if (frame->length() == 0) {
+        stream._frameStart = now;
+    }
+    stream._packetStart = frame->length();
+    frame->commit(length);
+    stream._flush = packetLength < VIDEO_PACKET_LENGTH;
+    return findComplete(stream);
+}
+
+bool tello::VideoAnalyzer::findComplete(DroneStream& stream) const {
+    FrameBuffer* frame = stream._frame;
+    optional<size_t> boundary = stream._parser.scan(frame->data(), frame->length());
+    if (boundary) {
+        stream._complete = *boundary;
+        // the end of the previous frame was lost, the next one started inside a packet
+        stream._corrupt = _limits._packetAlignedFrames &&
+                          (*boundary > stream._packetStart || *boundary + 1 < stream._packetStart);
+        return true;
+    }
 
-    return length < VIDEO_PACKET_LENGTH;
+    if (stream._flush && stream._parser.hasPicture()) {
+        stream._parser.finish(frame->data(), frame->length());
+        stream._complete = frame->length();
+        stream._corrupt = false;
+        stream._flush = false;
+        return true;
+    }
+    return false;
 }
 
-unsigned char* tello::VideoAnalyzer::frame(ip_address address) const {
-    unsigned int leng = length(address);
-    auto* frame = new unsigned char[length(address)];
-    int pos = 0;
+FrameHandle tello::VideoAnalyzer::take(ip_address address) {
+    auto found = _streams.find(address);
+    if (found == _streams.end()) {
+        return FrameHandle{};
+    }
+
+    DroneStream& stream = *found->second;
+    while (stream._complete != 0) {
+        FrameBuffer* complete = stream._frame;
+        FrameBuffer* next = _pool->acquire();
+
+        size_t remaining = complete->length() - stream._complete;
+        if (next == nullptr) {
+            // the complete frame is given up, its buffer takes the bytes of the next frame
+            stream._statistics._poolExhausted++;
+            stream._statistics._framesDropped++;
+            stream._statistics._bytesDropped += stream._complete;
+            const unsigned char* rest = complete->data() + stream._complete;
+            complete->clear();
+            std::memmove(complete->tail(), rest, remaining);
+            complete->commit(remaining);
+            stream._complete = 0;
+            stream._corrupt = false;
+            stream._packetStart = 0;
+            stream._frameStart = remaining > 0 ? stream._lastPacket : 0;
+            stream._parser.reset();
+            stream._waitForKeyframe = true;
+            if (remaining > 0) {
+                findComplete(stream);
+            }
+            continue;
+        }
+        if (next->available() < remaining && _pool->allocationForbidden()) {
+            // the start of the next frame does not fit, it is skipped up to the next start code
+            stream._statistics._capacityExceeded++;
+            stream._statistics._bytesDropped += remaining;
+            stream._statistics._lossEvents++;
+            stream._waitForKeyframe = true;
+            remaining = 0;
+        }
+        if (remaining > 0) {
+            next->reserve(remaining);
+            std::memcpy(next->tail(), complete->data() + stream._complete, remaining);
+            next->commit(remaining);
+        }
+        complete->truncate(stream._complete);
+        complete->setInfo(stream._parser.info());
+        bool corrupt = stream._corrupt;
+        int64_t frameStart = stream._frameStart;
+
+        stream._frame = next;
+        stream._complete = 0;
+        stream._corrupt = false;
+        stream._packetStart = 0;
+        stream._frameStart = remaining > 0 ? stream._lastPacket : 0;
+        stream._parser.reset();
 
-    auto frames = _frames.find(address);
-    for(const auto& response : *frames->second) {
-        memcpy(frame + pos, response._response, response._length);
-        pos += response._length;
+        if (corrupt) {
+            stream._statistics._corruptFrames++;
+            stream._statistics._lossEvents++;
+            stream._waitForKeyframe = true;
+        } else if (complete->info()._keyframe) {
+            stream._waitForKeyframe = false;
+        }
+
+        bool deliver = !corrupt && !stream._waitForKeyframe;
+        if (!deliver) {
+            stream._statistics._framesDropped++;
+            stream._statistics._bytesDropped += complete->length();
+            _pool->release(complete);
+        }
+
+        if (remaining > 0) {
+            findComplete(stream);
+        }
+
+        if (deliver) {
+            FrameInfo info = complete->info();
+            info._sequence = ++stream._sequence;
+            info._receiveTime = frameStart;
+            complete->setInfo(info);
+            stream._statistics._framesDelivered++;
+            return _pool->share(complete);
+        }
+    }
+    return FrameHandle{};
+}
+
+void tello::VideoAnalyzer::clean(ip_address address) {
+    auto found = _streams.find(address);
+    if (found != _streams.end()) {
+        discard(*found->second);
+    }
+}
+
+VideoStatistics tello::VideoAnalyzer::statistics(ip_address address) const {
+    auto found = _streams.find(address);
+    return found != _streams.end() ? found->second->_statistics : VideoStatistics();
+}
+
+void tello::VideoAnalyzer::discard(DroneStream& stream) {
+    if (stream._frame == nullptr) {
+        return;
+    }
+    if (stream._frame->length() > 0) {
+        stream._statistics._framesDropped++;
+        stream._statistics._lossEvents++;
+        stream._statistics._bytesDropped += stream._frame->length();
     }
-    return frame;
+    stream._frame->clear();
+    stream._parser.reset();
+    stream._complete = 0;
+    stream._flush = false;
+    stream._corrupt = false;
+    stream._packetStart = 0;
+    stream._waitForKeyframe = true;
 }
 
-unsigned int tello::VideoAnalyzer::length(ip_address address) const {
-    int size = 0;
+tello::DroneStream& tello::VideoAnalyzer::streamOf(ip_address address) {
+    auto found = _streams.find(address);
+    if (found != _streams.end()) {
+        return *found->second;
+    }
+
+    auto stream = std::make_unique<DroneStream>(address, _pool->acquire(), _nalUnitSink);
+    DroneStream& created = *stream;
+    _streams[address] = std::move(stream);
+    return created;
+}
 
-    auto frames = _frames.find(address);
-    for(const auto& frame : *frames->second) {
-        size += frame._length;
+FrameBuffer* tello::VideoAnalyzer::bufferOf(ip_address address) {
+    auto found = _streams.find(address);
+    if (found != _streams.end() && attach(*found->second)) {
+        return found->second->_frame;
     }
+    return _scratch.get();
+}
 
-    return size;
+void tello::VideoAnalyzer::makeRoom(DroneStream& stream, size_t length) {
+    FrameBuffer* frame = stream._frame;
+    if (frame->available() >= length) {
+        return;
+    }
+    if (_pool->allocationForbidden()) {
+        // real-time mode never reallocates, the frame is dropped and its buffer takes the next one
+        stream._statistics._capacityExceeded++;
+        discard(stream);
+        return;
+    }
+    frame->reserve(length);
 }
 
-void tello::VideoAnalyzer::clean(ip_address address) {
-    _frames.erase(address);
-}
\ No newline at end of file
+bool tello::VideoAnalyzer::attach(DroneStream& stream) {
+    if (stream._frame == nullptr) {
+        stream._frame = _pool->acquire();
+    }
+    return stream._frame != nullptr;
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include "tello/video/frame_pool.hpp"
+
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::video::FramePool;
+
+TEST(FramePool, Acquire_releasedBufferGiven_reuseBuffer) {
+    // Arrange
+    FramePool pool{1024, 2};
+    FrameBuffer* buffer = pool.acquire();
+    buffer->commit(10);
+
+    // Act
+    pool.release(buffer);
+    FrameBuffer* reused = pool.acquire();
+
+    // Assert
+    ASSERT_EQ(buffer, reused);
+    ASSERT_EQ(0, reused->length());
+    ASSERT_EQ(1, pool.allocated());
+    pool.release(reused);
+}
+
+TEST(FramePool, Share_lastHandleDropped_returnBufferToPool) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(1024, 2);
+    FrameBuffer* buffer = pool->acquire();
+    buffer->commit(10);
+
+    // Act
+    FrameHandle frame = pool->share(buffer);
+    FrameHandle copy = frame;
+    size_t pooledWhileShared = pool->pooled();
+    frame.reset();
+    size_t pooledWithOneHandle = pool->pooled();
+    copy.reset();
+
+    // Assert
+    ASSERT_EQ(0, pooledWhileShared);
+    ASSERT_EQ(0, pooledWithOneHandle);
+    ASSERT_EQ(1, pool->pooled());
+    ASSERT_EQ(buffer, pool->acquire());
+}
+
+TEST(FramePool, Share_handleOutlivesPool_bufferStillValid) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(1024, 2);
+    FrameBuffer* buffer = pool->acquire();
+    buffer->tail()[0] = 42;
+    buffer->commit(1);
+    FrameHandle frame = pool->share(buffer);
+
+    // Act
+    pool.reset();
+
+    // Assert
+    ASSERT_EQ(42, frame.data()[0]);
+}
+
+TEST(FramePool, Acquire_allocationForbidden_returnNullInsteadOfAllocating) {
+    // Arrange
+    FramePool pool{1024, 2};
+    pool.preallocate(2);
+    pool.forbidAllocation(true);
+    FrameBuffer* first = pool.acquire();
+    FrameBuffer* second = pool.acquire();
+
+    // Act
+    FrameBuffer* refused = pool.acquire();
+    pool.release(first);
+    FrameBuffer* released = pool.acquire();
+
+    // Assert
+    ASSERT_EQ(nullptr, refused);
+    ASSERT_EQ(first, released);
+    ASSERT_EQ(2, pool.allocated());
+    ASSERT_EQ(1, pool.refused());
+    pool.release(released);
+    pool.release(second);
+}
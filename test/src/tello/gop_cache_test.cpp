@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <tello/video/gop_cache.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include <vector>
+
+using tello::GopCache;
+using tello::GopCacheMode;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::FrameInfo;
+using std::vector;
+
+/**
+ * Frame of one byte 'id' without a pool
+ */
+FrameHandle cachedFrame(unsigned char id, bool keyframe, bool reference) {
+    auto* buffer = new FrameBuffer(16);
+    buffer->tail()[0] = id;
+    buffer->commit(1);
+    FrameInfo info;
+    info._keyframe = keyframe;
+    info._reference = reference;
+    buffer->setInfo(info);
+    return FrameHandle{buffer};
+}
+
+TEST(GopCache, Gop_framesAfterKeyframeGiven_returnKeyframeAndFollowing) {
+    // Arrange
+    GopCache cache;
+
+    // Act
+    cache.push(cachedFrame(1, false, true));
+    cache.push(cachedFrame(2, true, true));
+    cache.push(cachedFrame(3, false, true));
+    vector<FrameHandle> gop = cache.gop();
+
+    // Assert
+    ASSERT_EQ(2, gop.size());
+    ASSERT_EQ(2, gop[0].data()[0]);
+    ASSERT_EQ(3, gop[1].data()[0]);
+    ASSERT_EQ(2, cache.snapshot().data()[0]);
+    ASSERT_EQ(gop[0].data(), cache.snapshot().data());
+}
+
+TEST(GopCache, Gop_groupBeyondLimitGiven_keepSnapshotOnly) {
+    // Arrange
+    GopCache cache{2};
+
+    FrameHandle second = cachedFrame(2, false, true);
+
+    // Act
+    cache.push(cachedFrame(1, true, true));
+    cache.push(second);
+    cache.push(cachedFrame(3, false, true));
+
+    // Assert
+    ASSERT_TRUE(cache.gop().empty());
+    ASSERT_EQ(1, cache.snapshot().data()[0]);
+    ASSERT_EQ(1, second.useCount());
+}
+
+TEST(GopCache, Push_cacheDisabledGiven_holdNoFrame) {
+    // Arrange
+    GopCache cache{GOP_CACHE_MAX_FRAMES, GopCacheMode::DISABLED};
+    FrameHandle keyframe = cachedFrame(1, true, true);
+
+    // Act
+    cache.push(keyframe);
+    cache.require(GopCacheMode::KEYFRAME);
+    cache.push(cachedFrame(2, true, true));
+    FrameHandle following = cachedFrame(3, false, true);
+    cache.push(following);
+
+    // Assert
+    ASSERT_EQ(1, keyframe.useCount());
+    ASSERT_EQ(1, following.useCount());
+    ASSERT_EQ(2, cache.snapshot().data()[0]);
+    ASSERT_TRUE(cache.gop().empty());
+}
+
+TEST(GopCache, Limit_cachedGroupBeyondLimit_releaseFollowingFrames) {
+    // Arrange
+    GopCache cache;
+    FrameHandle following = cachedFrame(2, false, true);
+    cache.push(cachedFrame(1, true, true));
+    cache.push(following);
+    cache.push(cachedFrame(3, false, true));
+
+    // Act
+    cache.limit(2);
+    cache.push(cachedFrame(4, false, true));
+
+    // Assert
+    ASSERT_EQ(1, following.useCount());
+    ASSERT_TRUE(cache.gop().empty());
+    ASSERT_EQ(1, cache.snapshot().data()[0]);
+}
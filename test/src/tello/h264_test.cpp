@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include <tello/video/h264.hpp>
+#include <tello/video_analyzer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include "tello/video/access_unit_parser.hpp"
+#include "tello/video/start_code.hpp"
+#include "tello/video/rtp_packetizer.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define TELLO_IP_ADDRESS (ip_address)0xC0A80A01 // 192.168.10.1
+#define FULL_PACKET 1460
+
+using tello::NalUnitType;
+using tello::VideoFormat;
+using tello::FrameHandle;
+using tello::VideoAnalyzer;
+using tello::video::AccessUnitParser;
+using tello::video::findStartCode;
+using tello::video::RtpPacketizer;
+using tello::video::RtpPacket;
+using std::vector;
+
+/**
+ * Writes exp-Golomb coded syntax elements of a test bitstream
+ */
+class BitWriter {
+public:
+    void bits(uint32_t value, int count) {
+        for (int i = count - 1; i >= 0; i--) {
+            bit((value >> i) & 1);
+        }
+    }
+
+    void bit(uint32_t value) {
+        if (_position % 8 == 0) {
+            _bytes.push_back(0);
+        }
+        _bytes.back() |= value << (7 - _position % 8);
+        _position++;
+    }
+
+    void ue(uint32_t value) {
+        uint32_t coded = value + 1;
+        int length = 0;
+        for (uint32_t i = coded; i > 1; i >>= 1) {
+            length++;
+        }
+        bits(0, length);
+        bits(coded, length + 1);
+    }
+
+    /**
+     * NAL unit with start code, rbsp trailing bits and emulation prevention bytes
+     */
+    vector<unsigned char> nalUnit(unsigned char header) {
+        bit(1);
+        while (_position % 8 != 0) {
+            bit(0);
+        }
+
+        vector<unsigned char> nal{0, 0, 0, 1, header};
+        int zeros = 0;
+        for (unsigned char byte : _bytes) {
+            if (zeros >= 2 && byte <= 3) {
+                nal.push_back(3);
+                zeros = 0;
+            }
+            zeros = byte == 0 ? zeros + 1 : 0;
+            nal.push_back(byte);
+        }
+        return nal;
+    }
+
+private:
+    vector<unsigned char> _bytes;
+    size_t _position = 0;
+};
+
+/**
+ * Main profile SPS of the given size in macroblocks, cropped at the bottom, with 'frameRate' fps timing info
+ */
+vector<unsigned char> sps(uint32_t widthInMbs, uint32_t heightInMbs, uint32_t cropBottom, uint32_t frameRate) {
+    BitWriter writer;
+    writer.bits(77, 8); // profile_idc
+    writer.bits(0, 8);
+    writer.bits(40, 8); // level_idc
+    writer.ue(0);
+    writer.ue(0); // log2_max_frame_num_minus4
+    writer.ue(0); // pic_order_cnt_type
+    writer.ue(0);
+    writer.ue(1); // max_num_ref_frames
+    writer.bit(0);
+    writer.ue(widthInMbs - 1);
+    writer.ue(heightInMbs - 1);
+    writer.bit(1); // frame_mbs_only_flag
+    writer.bit(1);
+    writer.bit(cropBottom > 0 ? 1 : 0);
+    if (cropBottom > 0) {
+        writer.ue(0);
+        writer.ue(0);
+        writer.ue(0);
+        writer.ue(cropBottom);
+    }
+    writer.bit(1); // vui_parameters_present_flag
+    writer.bit(0);
+    writer.bit(0);
+    writer.bit(0);
+    writer.bit(0);
+    writer.bit(1); // timing_info_present_flag
+    writer.bits(1, 32);
+    writer.bits(frameRate * 2, 32);
+    writer.bit(1);
+    return writer.nalUnit(0x67);
+}
+
+vector<unsigned char> slice(unsigned char header, bool firstSlice, size_t length) {
+    vector<unsigned char> nal{0, 0, 0, 1, header, static_cast<unsigned char>(firstSlice ? 0x88 : 0x40)};
+    nal.resize(length, 0x5A);
+    return nal;
+}
+
+void append(vector<unsigned char>& stream, const vector<unsigned char>& nal) {
+    stream.insert(stream.end(), nal.begin(), nal.end());
+}
+
+TEST(H264, ParseSps_croppedSpsGiven_resolutionAndFrameRate) {
+    // Arrange
+    vector<unsigned char> nal = sps(120, 68, 4, 30);
+    VideoFormat format;
+
+    // Act
+    bool result = tello::parseSps(nal.data() + 4, nal.size() - 4, format);
+
+    // Assert
+    ASSERT_TRUE(result);
+    ASSERT_EQ(1920, format._width);
+    ASSERT_EQ(1080, format._height);
+    ASSERT_DOUBLE_EQ(30.0, format._frameRate);
+    ASSERT_EQ(77, format._profile);
+    ASSERT_EQ(40, format._level);
+}
+
+TEST(H264, ParseSps_truncatedSpsGiven_returnFalse) {
+    // Arrange
+    vector<unsigned char> nal = sps(60, 45, 0, 30);
+    VideoFormat format;
+
+    // Act
+    bool result = tello::parseSps(nal.data() + 4, 8, format);
+
+    // Assert
+    ASSERT_FALSE(result);
+}
+
+TEST(H264, FindStartCode_startCodesGiven_findAll) {
+    // Arrange
+    vector<unsigned char> data{7, 0, 0, 1, 9, 0, 0, 3, 0, 0, 0, 1, 0, 0};
+
+    // Act
+    size_t first = findStartCode(data.data(), 0, data.size());
+    size_t second = findStartCode(data.data(), first + 1, data.size());
+    size_t none = findStartCode(data.data(), second + 1, data.size());
+
+    // Assert
+    ASSERT_EQ(1, first);
+    ASSERT_EQ(9, second);
+    ASSERT_EQ(START_CODE_NOT_FOUND, none);
+}
+
+TEST(H264, FindStartCode_simdScannersGiven_sameResultAsScalar) {
+    // Arrange
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> bytes(0, 3);
+    vector<unsigned char> data(4096);
+    for (auto& byte : data) {
+        byte = static_cast<unsigned char>(bytes(random));
+    }
+
+    // Act & Assert
+    for (size_t from = 0; from < 200; from++) {
+        for (size_t length = from; length < data.size(); length += 97) {
+            size_t expected = tello::video::findStartCodeScalar(data.data(), from, length);
+            ASSERT_EQ(expected, findStartCode(data.data(), from, length));
+#ifdef TELLO_START_CODE_SIMD
+            ASSERT_EQ(expected, tello::video::findStartCodeSse2(data.data(), from, length));
+            if (tello::video::supportsAvx2()) {
+                ASSERT_EQ(expected, tello::video::findStartCodeAvx2(data.data(), from, length));
+            }
+#endif
+        }
+    }
+}
+
+TEST(H264, AccessUnitParser_sliceAfterPictureGiven_boundaryBeforeSlice) {
+    // Arrange
+    vector<unsigned char> stream;
+    append(stream, sps(60, 45, 0, 30));
+    append(stream, vector<unsigned char>{0, 0, 0, 1, 0x68, 0xCE, 0x38, 0x80});
+    append(stream, slice(0x65, true, 300));
+    append(stream, slice(0x65, false, 300));
+    size_t secondPicture = stream.size();
+    append(stream, slice(0x41, true, 300));
+    AccessUnitParser parser;
+
+    // Act
+    optional<size_t> boundary = parser.scan(stream.data(), stream.size());
+
+    // Assert
+    ASSERT_TRUE(boundary.has_value());
+    ASSERT_EQ(secondPicture, *boundary);
+    ASSERT_TRUE(parser.info()._keyframe);
+    ASSERT_TRUE(parser.info()._parameterSets);
+    ASSERT_EQ(tello::NalUnitType::IDR_SLICE, parser.info()._nalType);
+    ASSERT_EQ(4, parser.info()._nalUnits);
+    ASSERT_EQ(960, parser.format()._width);
+    ASSERT_EQ(720, parser.format()._height);
+}
+
+TEST(H264, AccessUnitParser_parameterSetsOnlyGiven_typeOfFirstParameterSet) {
+    // Arrange
+    vector<unsigned char> stream;
+    append(stream, sps(60, 45, 0, 30));
+    append(stream, vector<unsigned char>{0, 0, 0, 1, 0x68, 0xCE, 0x38, 0x80});
+    AccessUnitParser parser;
+
+    // Act
+    optional<size_t> boundary = parser.scan(stream.data(), stream.size());
+    parser.finish(stream.data(), stream.size());
+
+    // Assert
+    ASSERT_FALSE(boundary.has_value());
+    ASSERT_FALSE(parser.info()._keyframe);
+    ASSERT_TRUE(parser.info()._parameterSets);
+    ASSERT_EQ(tello::NalUnitType::SPS, parser.info()._nalType);
+}
+
+TEST(H264, AccessUnitParser_startCodeSplitBetweenScans_boundaryFound) {
+    // Arrange
+    vector<unsigned char> stream;
+    append(stream, slice(0x41, true, 100));
+    size_t secondPicture = stream.size();
+    append(stream, slice(0x41, true, 100));
+    AccessUnitParser parser;
+
+    // Act
+    optional<size_t> first = parser.scan(stream.data(), secondPicture + 2);
+    optional<size_t> second = parser.scan(stream.data(), secondPicture + 3);
+    optional<size_t> third = parser.scan(stream.data(), stream.size());
+
+    // Assert
+    ASSERT_FALSE(first.has_value());
+    ASSERT_FALSE(second.has_value());
+    ASSERT_TRUE(third.has_value());
+    ASSERT_EQ(secondPicture, *third);
+}
+
+TEST(VideoAnalyzer, Commit_frameOfPacketMultipleGiven_splitOnNextAccessUnit) {
+    // Arrange
+    VideoAnalyzer analyzer;
+    vector<unsigned char> stream;
+    append(stream, slice(0x65, true, 2 * FULL_PACKET));
+    append(stream, slice(0x41, true, FULL_PACKET));
+    vector<FrameHandle> frames;
+
+    // Act
+    for (size_t offset = 0; offset < stream.size(); offset += FULL_PACKET) {
+        size_t available = 0;
+        unsigned char* buffer = analyzer.receiveBuffer(TELLO_IP_ADDRESS, available);
+        std::memcpy(buffer, stream.data() + offset, FULL_PACKET);
+        if (analyzer.commit(TELLO_IP_ADDRESS, TELLO_IP_ADDRESS, FULL_PACKET, static_cast<int64_t>(offset))) {
+            for (FrameHandle frame = analyzer.take(TELLO_IP_ADDRESS); frame; frame = analyzer.take(TELLO_IP_ADDRESS)) {
+                frames.push_back(frame);
+            }
+        }
+    }
+
+    // Assert
+    ASSERT_EQ(1, frames.size());
+    ASSERT_EQ(2 * FULL_PACKET, frames[0].length());
+    ASSERT_TRUE(frames[0].info()._keyframe);
+}
+
+
+TEST(RtpPacketizer, Packetize_smallAndLargeNalUnitGiven_singleAndFragmentedPackets) {
+    // Arrange
+    RtpPacketizer packetizer{0x11223344, 96, 100};
+    vector<unsigned char> frame = {0, 0, 0, 1, 0x67, 1, 2, 3};
+    frame.insert(frame.end(), {0, 0, 1, 0x65});
+    frame.insert(frame.end(), 249, 7);
+
+    // Act
+    const vector<RtpPacket>& packets = packetizer.packetize(frame.data(), frame.size(), 1000000);
+
+    // Assert
+    ASSERT_EQ(4, packets.size());
+    ASSERT_EQ(0x80, packets[0]._header[0]);
+    ASSERT_EQ(96, packets[0]._header[1]);
+    ASSERT_EQ(12, packets[0]._headerLength);
+    ASSERT_EQ(4, packets[0]._payloadLength);
+    ASSERT_EQ(0x67, packets[0]._payload[0]);
+    // 90 kHz timestamp of one second
+    ASSERT_EQ(0x00, packets[0]._header[4]);
+    ASSERT_EQ(0x01, packets[0]._header[5]);
+    ASSERT_EQ(0x5F, packets[0]._header[6]);
+    ASSERT_EQ(0x90, packets[0]._header[7]);
+    ASSERT_EQ(0x44, packets[0]._header[11]);
+
+    // FU-A of the IDR slice: 249 bytes behind the NAL header in fragments of 98 bytes
+    ASSERT_EQ(14, packets[1]._headerLength);
+    ASSERT_EQ(0x60 | 28, packets[1]._header[12]);
+    ASSERT_EQ(0x80 | 5, packets[1]._header[13]);
+    ASSERT_EQ(98, packets[1]._payloadLength);
+    ASSERT_EQ(&frame[12], packets[1]._payload);
+    ASSERT_EQ(5, packets[2]._header[13]);
+    ASSERT_EQ(0x40 | 5, packets[3]._header[13]);
+    ASSERT_EQ(53, packets[3]._payloadLength);
+
+    // sequence numbers and marker bit on the last packet of the frame
+    ASSERT_EQ(3, packets[3]._header[3]);
+    ASSERT_EQ(0, packets[2]._header[1] & 0x80);
+    ASSERT_EQ(0x80, packets[3]._header[1] & 0x80);
+}
\ No newline at end of file
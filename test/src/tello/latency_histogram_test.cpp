@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include <tello/latency_histogram.hpp>
+
+using tello::LatencyHistogram;
+
+TEST(LatencyHistogram, Record_latenciesGiven_percentilesOfBuckets) {
+    // Arrange
+    LatencyHistogram histogram;
+
+    // Act
+    for (int i = 0; i < 90; i++) {
+        histogram.record(3);
+    }
+    for (int i = 0; i < 10; i++) {
+        histogram.record(1000);
+    }
+
+    // Assert
+    ASSERT_EQ(100, histogram.count());
+    ASSERT_EQ(90, histogram.bucket(2));
+    ASSERT_EQ(10, histogram.bucket(10));
+    ASSERT_EQ(4, histogram.percentile(50));
+    ASSERT_EQ(1024, histogram.percentile(99));
+    ASSERT_EQ(1000, histogram.max());
+    ASSERT_DOUBLE_EQ(102.7, histogram.mean());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <tello/telemetry/status_filter.hpp>
+
+using tello::StatusFilter;
+using tello::StatusSample;
+using tello::StatusField;
+
+StatusSample sampleWithHeight(int32_t height) {
+    StatusSample sample;
+    sample._h = height;
+    sample._bat = 80;
+    return sample;
+}
+
+TEST(StatusFilter, Accept_noRulesGiven_passAll) {
+    // Arrange
+    StatusFilter filter;
+    StatusSample sample = sampleWithHeight(10);
+
+    // Act
+    bool first = filter.accept(sample, 0);
+    bool second = filter.accept(sample, 1);
+
+    // Assert
+    ASSERT_TRUE(filter.passesAll());
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+}
+
+TEST(StatusFilter, Accept_deadbandGiven_rejectSmallChanges) {
+    // Arrange
+    StatusFilter filter;
+    filter.deadband(StatusField::H, 5.0);
+
+    // Act
+    bool first = filter.accept(sampleWithHeight(100), 0);
+    bool small = filter.accept(sampleWithHeight(103), 1);
+    bool large = filter.accept(sampleWithHeight(105), 2);
+    bool smallFromLastDelivered = filter.accept(sampleWithHeight(101), 3);
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(small);
+    ASSERT_TRUE(large);
+    ASSERT_FALSE(smallFromLastDelivered);
+}
+
+TEST(StatusFilter, Accept_deadbandGiven_ignoreOtherFields) {
+    // Arrange
+    StatusFilter filter;
+    filter.deadband(StatusField::H, 5.0);
+    StatusSample other = sampleWithHeight(100);
+    other._bat = 10;
+
+    // Act
+    filter.accept(sampleWithHeight(100), 0);
+    bool result = filter.accept(other, 1);
+
+    // Assert
+    ASSERT_FALSE(result);
+}
+
+TEST(StatusFilter, Accept_onChangeOnlyGiven_rejectEqualSamples) {
+    // Arrange
+    StatusFilter filter;
+    filter.onChangeOnly();
+
+    // Act
+    bool first = filter.accept(sampleWithHeight(100), 0);
+    bool equal = filter.accept(sampleWithHeight(100), 1);
+    bool changed = filter.accept(sampleWithHeight(101), 2);
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(equal);
+    ASSERT_TRUE(changed);
+}
+
+TEST(StatusFilter, Accept_maxRateGiven_decimateTo1Hz) {
+    // Arrange
+    StatusFilter filter;
+    filter.maxRate(1.0);
+    int delivered = 0;
+
+    // Act
+    for (int64_t timestamp = 0; timestamp < 5000000; timestamp += 100000) {
+        delivered += filter.accept(sampleWithHeight(100), timestamp) ? 1 : 0;
+    }
+
+    // Assert
+    ASSERT_EQ(5, delivered);
+}
+
+TEST(StatusFilter, Accept_resetCalled_passNextSample) {
+    // Arrange
+    StatusFilter filter;
+    filter.onChangeOnly();
+    filter.accept(sampleWithHeight(100), 0);
+
+    // Act
+    filter.reset();
+    bool result = filter.accept(sampleWithHeight(100), 1);
+
+    // Assert
+    ASSERT_TRUE(result);
+}
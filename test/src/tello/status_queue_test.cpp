@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <tello/telemetry/status_queue.hpp>
+
+using tello::StatusSample;
+using tello::StatusQueue;
+using tello::StatusDropPolicy;
+using tello::StatusQueueStatistics;
+using tello::QueuedStatus;
+
+StatusSample statusWithHeight(int32_t height) {
+    StatusSample sample;
+    sample._h = height;
+    sample._bat = 80;
+    return sample;
+}
+
+TEST(StatusQueue, Push_idleQueueGiven_startDrainOnce) {
+    // Arrange
+    StatusQueue queue(4);
+
+    // Act
+    bool first = queue.push(statusWithHeight(1), 100, 1);
+    bool second = queue.push(statusWithHeight(2), 200, 2);
+    std::optional<QueuedStatus> popped = queue.pop();
+    std::optional<QueuedStatus> next = queue.pop();
+    bool drained = !queue.pop().has_value();
+    bool restarted = queue.push(statusWithHeight(3), 300, 1);
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(second);
+    ASSERT_EQ(1, popped->_sample._h);
+    ASSERT_EQ(100, popped->_timestamp);
+    ASSERT_EQ(1, popped->_accepted);
+    ASSERT_EQ(2, next->_sample._h);
+    ASSERT_EQ(2, next->_accepted);
+    ASSERT_TRUE(drained);
+    ASSERT_TRUE(restarted);
+}
+
+TEST(StatusQueue, Push_fullQueueGiven_dropByPolicy) {
+    // Arrange
+    StatusQueue oldest(2, StatusDropPolicy::DROP_OLDEST);
+    StatusQueue newest(2, StatusDropPolicy::DROP_NEWEST);
+
+    // Act
+    for (int32_t height = 1; height <= 4; height++) {
+        oldest.push(statusWithHeight(height), height, 1);
+        newest.push(statusWithHeight(height), height, 1);
+    }
+    StatusQueueStatistics statistics = oldest.statistics();
+
+    // Assert
+    ASSERT_EQ(2, statistics._depth);
+    ASSERT_EQ(4, statistics._enqueued);
+    ASSERT_EQ(2, statistics._dropped);
+    ASSERT_EQ(3, oldest.pop()->_sample._h);
+    ASSERT_EQ(4, oldest.pop()->_sample._h);
+    ASSERT_EQ(1, newest.pop()->_sample._h);
+    ASSERT_EQ(2, newest.pop()->_sample._h);
+    ASSERT_EQ(2, newest.statistics()._dropped);
+}
+
+TEST(StatusQueue, Configure_smallerCapacityGiven_keepNewestUpdates) {
+    // Arrange
+    StatusQueue queue(4);
+    for (int32_t height = 1; height <= 4; height++) {
+        queue.push(statusWithHeight(height), height, 1);
+    }
+
+    // Act
+    queue.configure(1, StatusDropPolicy::DROP_OLDEST);
+
+    // Assert
+    ASSERT_EQ(3, queue.statistics()._dropped);
+    ASSERT_EQ(4, queue.pop()->_sample._h);
+    ASSERT_FALSE(queue.pop().has_value());
+}
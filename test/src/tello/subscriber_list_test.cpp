@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "tello/thread/subscriber_list.hpp"
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <thread>
+
+using tello::Subscription;
+using tello::threading::SubscriberList;
+
+using counter_handler = std::function<void(int)>;
+
+TEST(SubscriberList, ForEach_twoSubscribersGiven_callBoth) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<counter_handler>>();
+    int first = 0;
+    int second = 0;
+    Subscription firstSubscription{subscribers, subscribers->add([&first](int value) { first += value; })};
+    Subscription secondSubscription{subscribers, subscribers->add([&second](int value) { second += value; })};
+
+    // Act
+    subscribers->forEach([](const counter_handler& handler) { handler(2); });
+
+    // Assert
+    ASSERT_EQ(2, first);
+    ASSERT_EQ(2, second);
+}
+
+TEST(SubscriberList, ForEachSlot_subscriberRemovedAndAdded_keepSlotsAndReuseFreedOneLast) {
+    // Arrange
+    SubscriberList<int> subscribers;
+    uint64_t first = subscribers.add(1);
+    subscribers.add(2);
+    subscribers.unsubscribe(first);
+    subscribers.add(3);
+    std::vector<std::pair<size_t, int>> slots;
+
+    // Act
+    subscribers.forEachSlot([&slots](size_t slot, int subscriber) { slots.emplace_back(slot, subscriber); });
+
+    // Assert
+    ASSERT_EQ(2, slots.size());
+    ASSERT_EQ(1, slots[0].first);
+    ASSERT_EQ(2, slots[0].second);
+    ASSERT_EQ(2, slots[1].first);
+    ASSERT_EQ(3, slots[1].second);
+}
+
+TEST(SubscriberList, Subscription_tokenDestroyed_removeSubscriber) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<counter_handler>>();
+    int calls = 0;
+
+    // Act
+    {
+        Subscription subscription{subscribers, subscribers->add([&calls](int) { calls++; })};
+        subscribers->forEach([](const counter_handler& handler) { handler(0); });
+    }
+    subscribers->forEach([](const counter_handler& handler) { handler(0); });
+
+    // Assert
+    ASSERT_EQ(1, calls);
+    ASSERT_TRUE(subscribers->empty());
+}
+
+TEST(SubscriberList, Subscription_listDestroyedFirst_tokenInactive) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<counter_handler>>();
+    Subscription subscription{subscribers, subscribers->add([](int) {})};
+
+    // Act
+    subscribers.reset();
+
+    // Assert
+    ASSERT_FALSE(subscription.active());
+    subscription.unsubscribe();
+}
+
+TEST(SubscriberList, Unsubscribe_insideHandler_noDeadlock) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<counter_handler>>();
+    Subscription subscription;
+    int calls = 0;
+    subscription = Subscription{subscribers, subscribers->add([&subscription, &calls](int) {
+        calls++;
+        subscription.unsubscribe();
+    })};
+
+    // Act
+    subscribers->forEach([](const counter_handler& handler) { handler(0); });
+    subscribers->forEach([](const counter_handler& handler) { handler(0); });
+
+    // Assert
+    ASSERT_EQ(1, calls);
+}
+
+TEST(SubscriberList, ForEach_concurrentSubscribeAndUnsubscribe_dispatchConsistentSnapshots) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<counter_handler>>();
+    std::atomic<long> sum{0};
+    Subscription permanent{subscribers, subscribers->add([&sum](int value) { sum += value; })};
+    std::atomic<bool> running{true};
+
+    // Act
+    std::thread dispatcher([&subscribers, &running]() {
+        while (running) {
+            subscribers->forEach([](const counter_handler& handler) { handler(1); });
+        }
+    });
+    for (int i = 0; i < 2000; i++) {
+        Subscription temporary{subscribers, subscribers->add([](int) {})};
+    }
+    running = false;
+    dispatcher.join();
+    long before = sum;
+    subscribers->forEach([](const counter_handler& handler) { handler(1); });
+
+    // Assert
+    ASSERT_EQ(before + 1, sum);
+    ASSERT_TRUE(permanent.active());
+}
+
+struct Canary {
+    int _value;
+};
+
+TEST(SubscriberList, ForEach_readersRaceSeveralWriters_neverSeeFreedSnapshot) {
+    // Arrange
+    auto subscribers = std::make_shared<SubscriberList<Canary>>();
+    Subscription permanent{subscribers, subscribers->add(Canary{42})};
+    std::atomic<bool> running{true};
+    std::atomic<long> corrupt{0};
+    std::vector<std::thread> readers;
+    std::vector<std::thread> writers;
+
+    // Act
+    for (int i = 0; i < 6; i++) {
+        readers.emplace_back([&subscribers, &running, &corrupt]() {
+            while (running) {
+                subscribers->forEach([&corrupt](const Canary& canary) {
+                    std::this_thread::yield();
+                    if (canary._value != 42) {
+                        corrupt++;
+                    }
+                });
+            }
+        });
+    }
+    for (int i = 0; i < 2; i++) {
+        writers.emplace_back([&subscribers]() {
+            for (int j = 0; j < 20000; j++) {
+                subscribers->unsubscribe(subscribers->add(Canary{42}));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    running = false;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    // Assert
+    ASSERT_EQ(0, corrupt);
+    ASSERT_TRUE(permanent.active());
+}
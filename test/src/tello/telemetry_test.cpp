@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+#include <tello/telemetry/status_sample.hpp>
+#include <tello/telemetry/telemetry_recorder.hpp>
+#include <tello/telemetry/telemetry_reader.hpp>
+#include <tello/telemetry/telemetry_archive.hpp>
+#include <tello/telemetry/telemetry_query.hpp>
+#include <tello/telemetry/telemetry_table.hpp>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#define TELLO_IP_ADDRESS (ip_address)0xC0A80A01 // 192.168.10.1
+
+using tello::StatusSample;
+using tello::StatusField;
+using tello::TelemetryRecorder;
+using tello::TelemetryReader;
+using tello::TelemetryBlock;
+using tello::TelemetryArchiveWriter;
+using tello::TelemetryArchiveReader;
+using tello::TelemetryColumns;
+using tello::FieldSelection;
+using tello::TelemetryQuery;
+using tello::TelemetryQueryEngine;
+using tello::TelemetryQueryResult;
+using tello::TelemetryTable;
+using tello::TelemetryTableReader;
+using tello::TelemetrySnapshot;
+using std::string;
+
+const string STATUS_DATAGRAM = "mid:-1;x:-100;y:-100;z:-100;mpry:-1,-1,-1;pitch:-1;roll:0;yaw:0;vgx:10;vgy:10;vgz:10;templ:55;temph:57;tof:10;h:0;bat:55;baro:681.32;time:0;agx:-10.00;agy:-3.00;agz:-1000.00;\r\n";
+
+TEST(Telemetry, ParseStatusSample_allFieldsGiven_decodeAllFields) {
+    // Arrange
+    StatusSample sample;
+
+    // Act
+    bool result = StatusSample::parse(STATUS_DATAGRAM.c_str(), STATUS_DATAGRAM.length(), sample);
+
+    // Assert
+    ASSERT_TRUE(result);
+    ASSERT_EQ(-1, sample._mid);
+    ASSERT_EQ(-100, sample._x);
+    ASSERT_EQ(-1, sample._pitch);
+    ASSERT_EQ(10, sample._vgz);
+    ASSERT_EQ(57, sample._temph);
+    ASSERT_EQ(55, sample._bat);
+    ASSERT_FLOAT_EQ(681.32f, sample._baro);
+    ASSERT_FLOAT_EQ(-1000.0f, sample._agz);
+    ASSERT_DOUBLE_EQ(-3.0, sample.value(StatusField::AGY));
+}
+
+TEST(Telemetry, ParseStatusSample_noStatusGiven_returnFalse) {
+    // Arrange
+    StatusSample sample;
+    string datagram = "ok";
+
+    // Act && Assert
+    ASSERT_FALSE(StatusSample::parse(datagram.c_str(), datagram.length(), sample));
+}
+
+TEST(Telemetry, ParseStatusSample_malformedIntegersGiven_skipOnlyThoseFields) {
+    // Arrange
+    StatusSample sample;
+    sample._x = 7;
+    sample._y = 7;
+    sample._z = 7;
+    sample._bat = 7;
+    string datagram = "x:-;y:12abc;z:2147483648;bat:+;h:-2147483648;tof:2147483647;\r\n";
+
+    // Act
+    bool result = StatusSample::parse(datagram.c_str(), datagram.length(), sample);
+
+    // Assert
+    ASSERT_TRUE(result);
+    ASSERT_EQ(7, sample._x);
+    ASSERT_EQ(7, sample._y);
+    ASSERT_EQ(7, sample._z);
+    ASSERT_EQ(7, sample._bat);
+    ASSERT_EQ(INT32_MIN, sample._h);
+    ASSERT_EQ(INT32_MAX, sample._tof);
+}
+
+TEST(Telemetry, FieldByName_knownAndUnknownNames) {
+    ASSERT_EQ(StatusField::BARO, tello::fieldByName("baro").value());
+    ASSERT_EQ(string("agx"), tello::fieldName(StatusField::AGX));
+    ASSERT_FALSE(tello::fieldByName("mpry").has_value());
+}
+
+TEST(Telemetry, RecordAndRead_samplesOfSeveralBlocks_readBackColumns) {
+    // Arrange
+    string directory = ".";
+    string path = TelemetryRecorder::path(directory, TELLO_IP_ADDRESS);
+    std::remove(path.c_str());
+    StatusSample sample;
+    StatusSample::parse(STATUS_DATAGRAM.c_str(), STATUS_DATAGRAM.length(), sample);
+
+    // Act
+    {
+        TelemetryRecorder recorder(directory, 4);
+        for (int i = 0; i < 10; i++) {
+            sample._bat = 100 - i;
+            sample._agx = static_cast<float>(i) / 2;
+            ASSERT_TRUE(recorder.record(TELLO_IP_ADDRESS, 1000 + i, sample));
+        }
+        recorder.stop();
+        ASSERT_EQ(10u, recorder.recorded());
+    }
+
+    // Assert
+    TelemetryReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(TELLO_IP_ADDRESS, reader.drone());
+    ASSERT_EQ(3u, reader.blockCount());
+    ASSERT_EQ(10u, reader.sampleCount());
+
+    TelemetryBlock block = reader.block(1);
+    ASSERT_EQ(4u, block.count());
+    ASSERT_EQ(1004, block.firstTimestamp());
+    ASSERT_EQ(1007, block.lastTimestamp());
+    ASSERT_DOUBLE_EQ(93.0, block.min(StatusField::BAT));
+    ASSERT_DOUBLE_EQ(96.0, block.max(StatusField::BAT));
+    ASSERT_EQ(95, block.intColumn(StatusField::BAT)[1]);
+    ASSERT_FLOAT_EQ(2.5f, block.floatColumn(StatusField::AGX)[1]);
+    ASSERT_EQ(nullptr, block.intColumn(StatusField::AGX));
+    ASSERT_EQ(-100, block.sample(3)._y);
+
+    reader.close();
+    std::remove(path.c_str());
+}
+
+TEST(Telemetry, ArchiveRoundTrip_flightLikeSamples_decodeIdenticalAndCompress) {
+    // Arrange
+    string path = "./telemetry_archive_test.tta";
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> jitter(-2000, 2000);
+    std::uniform_int_distribution<int> step(-1, 1);
+    vector<int64_t> timestamps;
+    vector<StatusSample> samples;
+
+    StatusSample sample;
+    StatusSample::parse(STATUS_DATAGRAM.c_str(), STATUS_DATAGRAM.length(), sample);
+    for (int i = 0; i < 5000; i++) {
+        sample._pitch += step(random);
+        sample._h = i / 50;
+        sample._bat = 100 - i / 600;
+        sample._time = i / 10;
+        sample._baro = 681.32f + static_cast<float>(step(random)) * 0.01f;
+        sample._agx = static_cast<float>(-10 + step(random));
+        timestamps.push_back(1600000000000000LL + i * 100000LL + jitter(random));
+        samples.push_back(sample);
+    }
+
+    // Act
+    TelemetryArchiveWriter writer(1024);
+    ASSERT_TRUE(writer.open(path, TELLO_IP_ADDRESS));
+    for (size_t i = 0; i < samples.size(); i++) {
+        ASSERT_TRUE(writer.append(timestamps[i], samples[i]));
+    }
+    ASSERT_TRUE(writer.close());
+
+    // Assert
+    ASSERT_GE(writer.rawBytes() / writer.encodedBytes(), 5u);
+
+    TelemetryArchiveReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(TELLO_IP_ADDRESS, reader.drone());
+    ASSERT_EQ(5u, reader.blockCount());
+    ASSERT_EQ(samples.size(), reader.sampleCount());
+
+    size_t position = 0;
+    TelemetryColumns columns;
+    for (size_t b = 0; b < reader.blockCount(); b++) {
+        ASSERT_TRUE(reader.decode(b, columns));
+        for (size_t i = 0; i < columns._count; i++, position++) {
+            ASSERT_EQ(timestamps[position], columns._timestamps[i]);
+            for (int f = 0; f < STATUS_FIELD_COUNT; f++) {
+                auto field = static_cast<StatusField>(f);
+                ASSERT_EQ(samples[position].bits(field), columns._columns[f][i]);
+            }
+        }
+    }
+    ASSERT_EQ(samples.size(), position);
+
+    FieldSelection battery;
+    battery.set(static_cast<int>(StatusField::BAT));
+    ASSERT_TRUE(reader.decode(4, columns, battery, false));
+    ASSERT_TRUE(columns._timestamps.empty());
+    ASSERT_TRUE(columns._columns[static_cast<int>(StatusField::AGX)].empty());
+    ASSERT_DOUBLE_EQ(reader.index(4)._min[static_cast<int>(StatusField::BAT)],
+                     columns.value(StatusField::BAT, columns._count - 1));
+
+    reader.close();
+    std::remove(path.c_str());
+}
+
+TEST(Telemetry, Query_timeRangeAndPredicate_skipBlocksAndAggregate) {
+    // Arrange
+    string firstPath = "./telemetry_query_test_1.tta";
+    string secondPath = "./telemetry_query_test_2.tta";
+    StatusSample sample;
+    for (const auto& path : {firstPath, secondPath}) {
+        TelemetryArchiveWriter writer(100);
+        ASSERT_TRUE(writer.open(path, TELLO_IP_ADDRESS));
+        for (int i = 0; i < 1000; i++) {
+            sample._bat = 100 - i / 10;
+            sample._pitch = i < 500 ? 0 : i % 20;
+            ASSERT_TRUE(writer.append(1000000LL * 1000 + i * 100000LL, sample));
+        }
+        ASSERT_TRUE(writer.close());
+    }
+
+    TelemetryQuery query;
+    query._relativeTime = true;
+    query._from = 60 * 1000000LL;
+    query._to = 90 * 1000000LL;
+    query._predicates.push_back({StatusField::PITCH, 10, 100});
+    query._fields.set(static_cast<int>(StatusField::BAT));
+    query._fields.set(static_cast<int>(StatusField::PITCH));
+
+    // Act
+    TelemetryQueryEngine engine(2);
+    TelemetryQueryResult result = engine.run({firstPath, secondPath, "./missing.tta"}, query);
+
+    // Assert
+    ASSERT_EQ(1u, result._failed.size());
+    ASSERT_EQ(2u, result._recordings.size());
+    ASSERT_EQ(6u, result._blocksScanned);
+    ASSERT_EQ(14u, result._blocksSkipped);
+
+    const auto& aggregate = result._recordings[0]._aggregate;
+    ASSERT_EQ(150u, aggregate._samples);
+    const auto& pitch = aggregate._fields[static_cast<int>(StatusField::PITCH)];
+    ASSERT_DOUBLE_EQ(10.0, pitch._min);
+    ASSERT_DOUBLE_EQ(19.0, pitch._max);
+    const auto& battery = aggregate._fields[static_cast<int>(StatusField::BAT)];
+    ASSERT_DOUBLE_EQ(39.0, battery._first);
+    ASSERT_DOUBLE_EQ(11.0, battery._last);
+    ASSERT_NEAR(-1.0, battery.rate(), 0.05);
+    ASSERT_EQ(300u, result._drones[TELLO_IP_ADDRESS]._samples);
+
+    std::remove(firstPath.c_str());
+    std::remove(secondPath.c_str());
+}
+
+TEST(Telemetry, TelemetryTable_updatesOfTwoDronesGiven_readLatestSamples) {
+    // Arrange
+    string path = "telemetry_table_test.tvtab";
+    ip_address secondDrone = TELLO_IP_ADDRESS + 1;
+    StatusSample sample;
+    StatusSample::parse(STATUS_DATAGRAM.c_str(), STATUS_DATAGRAM.length(), sample);
+    TelemetryTableReader reader;
+
+    // Act
+    {
+        TelemetryTable table(path, 2);
+        table.update(TELLO_IP_ADDRESS, 1000, sample);
+        sample._bat = 54;
+        table.update(TELLO_IP_ADDRESS, 2000, sample);
+        sample._bat = 90;
+        table.update(secondDrone, 3000, sample);
+        ASSERT_FALSE(table.update(TELLO_IP_ADDRESS + 2, 4000, sample));
+
+        ASSERT_TRUE(reader.open(path));
+        std::optional<TelemetrySnapshot> first = reader.read(TELLO_IP_ADDRESS);
+        std::optional<TelemetrySnapshot> second = reader.read(secondDrone);
+
+        // Assert
+        ASSERT_EQ(2, reader.drones().size());
+        ASSERT_TRUE(first.has_value());
+        ASSERT_EQ(2000, first->_timestamp);
+        ASSERT_EQ(2, first->_updates);
+        ASSERT_EQ(54, first->_sample._bat);
+        ASSERT_EQ(-100, first->_sample._x);
+        ASSERT_TRUE(second.has_value());
+        ASSERT_EQ(90, second->_sample._bat);
+        ASSERT_FALSE(reader.read(TELLO_IP_ADDRESS + 2).has_value());
+        reader.close();
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include "tello/thread/thread_pool.hpp"
+#include <tello/task.hpp>
+#include "tello/thread/thread_pool_executor.hpp"
+#include <tello/executor.hpp>
+#include <tello/video/video_queue.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/latency_histogram.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#define DRONES 2
+#define FRAMES 500
+
+using tello::threading::Threadpool;
+using tello::threading::Task;
+using tello::LatencyHistogram;
+using tello::Executor;
+using tello::InlineExecutor;
+using tello::threading::ThreadPoolExecutor;
+using tello::VideoQueue;
+using tello::FrameHandle;
+using tello::FrameBuffer;
+
+struct DroneDispatch {
+    VideoQueue _queue{FRAMES};
+    std::vector<int> _delivered;
+    std::atomic<int> _running{0};
+    bool _overlapped = false;
+};
+
+FrameHandle numberedFrame(int number) {
+    auto* buffer = new FrameBuffer(sizeof(number));
+    std::memcpy(buffer->tail(), &number, sizeof(number));
+    buffer->commit(sizeof(number));
+    return FrameHandle{buffer};
+}
+
+TEST(Threadpool, Resize_threadsGiven_changeWorkerCount) {
+    // Arrange
+    Threadpool threadpool{1};
+
+    // Act
+    threadpool.resize(3);
+
+    // Assert
+    ASSERT_EQ(3, threadpool.size());
+    threadpool.stop();
+}
+
+TEST(Threadpool, Constructor_noSizeGiven_oneWorkerPerCoreUpToLimit) {
+    // Arrange
+    unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // Act
+    Threadpool threadpool;
+
+    // Assert
+    ASSERT_EQ(static_cast<int>(std::min(cores, (unsigned int) MAX_DEFAULT_THREADS)), threadpool.size());
+    threadpool.stop();
+}
+
+TEST(Threadpool, Push_drainPerDroneGiven_deliverFramesInOrder) {
+    // Arrange
+    Threadpool threadpool{4};
+    std::vector<std::unique_ptr<DroneDispatch>> drones;
+    for (int i = 0; i < DRONES; i++) {
+        drones.push_back(std::make_unique<DroneDispatch>());
+    }
+
+    // Act
+    for (int frame = 0; frame < FRAMES; frame++) {
+        for (auto& drone : drones) {
+            DroneDispatch* dispatch = drone.get();
+            if (dispatch->_queue.push(numberedFrame(frame))) {
+                threadpool.push([dispatch](int) {
+                    for (FrameHandle next = dispatch->_queue.pop(); next; next = dispatch->_queue.pop()) {
+                        dispatch->_overlapped |= dispatch->_running.fetch_add(1) != 0;
+                        int number;
+                        std::memcpy(&number, next.data(), sizeof(number));
+                        dispatch->_delivered.push_back(number);
+                        dispatch->_running.fetch_sub(1);
+                    }
+                });
+            }
+        }
+    }
+    for (auto& drone : drones) {
+        while (drone->_queue.statistics()._delivered < FRAMES) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    threadpool.stop();
+
+    // Assert
+    for (auto& drone : drones) {
+        ASSERT_FALSE(drone->_overlapped);
+        ASSERT_EQ(FRAMES, drone->_delivered.size());
+        for (int frame = 0; frame < FRAMES; frame++) {
+            ASSERT_EQ(frame, drone->_delivered[frame]);
+        }
+    }
+}
+
+TEST(Task, Constructor_smallAndLargeCallablesGiven_allocateOnlyLarge) {
+    // Arrange
+    auto counter = std::make_shared<int>(0);
+    char padding[64] = {1};
+
+    // Act
+    Task small{[counter](int worker) { *counter += worker; }};
+    Task big{[counter, padding](int worker) { *counter += padding[0] + worker; }};
+    Task moved{std::move(small)};
+    moved(2);
+    big(3);
+
+    // Assert
+    ASSERT_FALSE(moved.allocated());
+    ASSERT_FALSE(static_cast<bool>(small));
+    ASSERT_TRUE(big.allocated());
+    ASSERT_EQ(6, *counter);
+}
+
+TEST(Threadpool, Push_tasksOfOneWorkerGiven_stealByIdleWorkers) {
+    // Arrange
+    Threadpool threadpool{4};
+    std::mutex workersMutex;
+    std::set<int> workers;
+    std::atomic<int> done{0};
+
+    // Act
+    threadpool.push([&](int) {
+        // every task is queued on the deque of this worker, the others have to steal
+        for (int i = 0; i < 64; i++) {
+            threadpool.push([&](int worker) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                std::lock_guard<std::mutex> lock(workersMutex);
+                workers.insert(worker);
+                done++;
+            });
+        }
+    });
+    while (done < 64) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    threadpool.stop();
+
+    // Assert
+    ASSERT_GT(workers.size(), 1);
+}
+
+TEST(Threadpool, SetWakeupLatency_tasksPushed_recordEveryTask) {
+    // Arrange
+    Threadpool threadpool{2};
+    LatencyHistogram wakeupLatency;
+    std::atomic<int> setups{0};
+    std::atomic<int> done{0};
+    threadpool.setWorkerSetup([&setups](int, std::thread&) { setups++; });
+    threadpool.setWakeupLatency(&wakeupLatency);
+
+    // Act
+    threadpool.resize(3);
+    for (int i = 0; i < 10; i++) {
+        threadpool.push([&done](int) { done++; });
+    }
+    while (done < 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    threadpool.stop();
+
+    // Assert
+    ASSERT_EQ(3, setups);
+    ASSERT_EQ(10, wakeupLatency.count());
+}
+
+TEST(Executor, Post_inlineAndThreadPoolExecutorGiven_runOnCallerOrWorker) {
+    // Arrange
+    Threadpool threadpool{1};
+    InlineExecutor inlineExecutor;
+    ThreadPoolExecutor poolExecutor{threadpool};
+    Executor& executor = poolExecutor;
+    std::thread::id inlineThread;
+    std::atomic<bool> pooled{false};
+    std::thread::id pooledThread;
+
+    // Act
+    inlineExecutor.post([&inlineThread](int) { inlineThread = std::this_thread::get_id(); });
+    executor.post([&pooled, &pooledThread](int) {
+        pooledThread = std::this_thread::get_id();
+        pooled = true;
+    });
+    while (!pooled) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    threadpool.stop();
+
+    // Assert
+    ASSERT_EQ(std::this_thread::get_id(), inlineThread);
+    ASSERT_NE(std::this_thread::get_id(), pooledThread);
+}
+
+TEST(Executor, Post_dispatchCapturingTwoSharedPointersGiven_storeInline) {
+    // Arrange
+    auto subscribers = std::make_shared<int>(1);
+    auto queue = std::make_shared<int>(2);
+    InlineExecutor executor;
+    int sum = 0;
+
+    // Act
+    tello::executor_task task{[subscribers, queue, &sum](int) { sum = *subscribers + *queue; }};
+    bool allocated = task.allocated();
+    executor.post(std::move(task));
+
+    // Assert
+    ASSERT_FALSE(allocated);
+    ASSERT_EQ(3, sum);
+}
@@ -0,0 +1,431 @@
+#include <gtest/gtest.h>
+#include <tello/video_analyzer.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include <tello/response/video_response.hpp>
+#include "tello/video/frame_pool.hpp"
+#include <cstring>
+#include <vector>
+
+#define FIRST_DRONE (ip_address)0xC0A80A01 // 192.168.10.1
+#define SECOND_DRONE (ip_address)0xC0A80A02 // 192.168.10.2
+#define FULL_PACKET 1460
+
+using tello::VideoAnalyzer;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::VideoResponse;
+using tello::VideoLimits;
+using tello::VideoStatistics;
+using tello::video::FramePool;
+using tello::NalUnitSink;
+
+std::vector<unsigned char> videoPacket(size_t length, unsigned char fill, bool start, unsigned char nalHeader = 0x65) {
+    std::vector<unsigned char> packet(length, fill);
+    if (start) {
+        packet[0] = 0;
+        packet[1] = 0;
+        packet[2] = 0;
+        packet[3] = 1;
+        packet[4] = nalHeader; // IDR slice per default
+        packet[5] = 0x88; // first_mb_in_slice 0
+    }
+    return packet;
+}
+
+bool receive(VideoAnalyzer& analyzer, ip_address expected, ip_address sender, const std::vector<unsigned char>& packet,
+             int64_t now = 0) {
+    size_t available = 0;
+    unsigned char* buffer = analyzer.receiveBuffer(expected, available);
+    EXPECT_GE(available, packet.size());
+    std::memcpy(buffer, packet.data(), packet.size());
+    return analyzer.commit(expected, sender, packet.size(), now);
+}
+
+/**
+ * Frame of 'packets' full packets and a short last packet
+ */
+int receiveFrame(VideoAnalyzer& analyzer, unsigned char nalHeader, int packets, int64_t now = 0) {
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true, nalHeader), now);
+    for (int i = 1; i < packets; i++) {
+        receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, false), now);
+    }
+    int delivered = 0;
+    if (receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false), now)) {
+        for (FrameHandle frame = analyzer.take(FIRST_DRONE); frame; frame = analyzer.take(FIRST_DRONE)) {
+            delivered++;
+        }
+    }
+    return delivered;
+}
+
+struct ReceivedNalUnit {
+    ip_address _address;
+    unsigned char _header;
+    size_t _length;
+    bool _lastInFrame;
+    int64_t _receiveTime;
+};
+
+class RecordingSink : public NalUnitSink {
+public:
+    std::vector<ReceivedNalUnit> _nalUnits;
+
+    void nalUnit(ip_address address, const unsigned char* data, size_t length, bool lastInFrame,
+                 int64_t receiveTime) override {
+        _nalUnits.push_back(ReceivedNalUnit{address, data[4], length, lastInFrame, receiveTime});
+    }
+};
+
+/**
+ * SPS, PPS and a slice, every NAL unit with a 4 byte start code
+ */
+std::vector<unsigned char> parameterSetPacket(unsigned char sliceHeader, size_t sliceLength) {
+    std::vector<unsigned char> packet = videoPacket(20, 1, true, 0x67);
+    std::vector<unsigned char> pps = videoPacket(10, 1, true, 0x68);
+    std::vector<unsigned char> slice = videoPacket(sliceLength, 1, true, sliceHeader);
+    packet.insert(packet.end(), pps.begin(), pps.end());
+    packet.insert(packet.end(), slice.begin(), slice.end());
+    return packet;
+}
+
+TEST(VideoAnalyzer, Commit_nalUnitSinkGiven_passNalUnitsOnArrival) {
+    // Arrange
+    RecordingSink sink;
+    VideoAnalyzer analyzer{std::make_shared<FramePool>(), VideoLimits(), &sink};
+    std::vector<unsigned char> first = parameterSetPacket(0x65, FULL_PACKET - 30);
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, first, 10);
+    size_t beforeFrameEnd = sink._nalUnits.size();
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false), 20);
+
+    // Assert
+    ASSERT_EQ(2, beforeFrameEnd);
+    ASSERT_EQ(3, sink._nalUnits.size());
+    ASSERT_EQ(FIRST_DRONE, sink._nalUnits[0]._address);
+    ASSERT_EQ(0x67, sink._nalUnits[0]._header);
+    ASSERT_EQ(20, sink._nalUnits[0]._length);
+    ASSERT_FALSE(sink._nalUnits[0]._lastInFrame);
+    ASSERT_EQ(10, sink._nalUnits[0]._receiveTime);
+    ASSERT_EQ(0x68, sink._nalUnits[1]._header);
+    ASSERT_EQ(0x65, sink._nalUnits[2]._header);
+    ASSERT_EQ(FULL_PACKET - 30 + 100, sink._nalUnits[2]._length);
+    ASSERT_TRUE(sink._nalUnits[2]._lastInFrame);
+    ASSERT_EQ(20, sink._nalUnits[2]._receiveTime);
+}
+
+TEST(VideoAnalyzer, Commit_nalUnitSinkWithoutKeyframeGiven_skipNalUnits) {
+    // Arrange
+    RecordingSink sink;
+    VideoAnalyzer analyzer{std::make_shared<FramePool>(), VideoLimits(), &sink};
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, true, 0x41));
+    FrameHandle skipped = analyzer.take(FIRST_DRONE);
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, parameterSetPacket(0x65, 100));
+
+    // Assert
+    ASSERT_FALSE(skipped);
+    ASSERT_EQ(3, sink._nalUnits.size());
+    ASSERT_EQ(0x67, sink._nalUnits[0]._header);
+    ASSERT_EQ(0x65, sink._nalUnits[2]._header);
+    ASSERT_TRUE(sink._nalUnits[2]._lastInFrame);
+}
+
+TEST(VideoAnalyzer, Commit_shortPacketGiven_frameComplete) {
+    // Arrange
+    VideoAnalyzer analyzer;
+
+    // Act
+    bool first = receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 7, true));
+    bool second = receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 8, false));
+    FrameHandle frame = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_FALSE(first);
+    ASSERT_TRUE(second);
+    ASSERT_EQ(FULL_PACKET + 100, frame.length());
+    ASSERT_EQ(1, frame.data()[3]);
+    ASSERT_EQ(7, frame.data()[FULL_PACKET - 1]);
+    ASSERT_EQ(8, frame.data()[FULL_PACKET]);
+}
+
+TEST(VideoAnalyzer, Commit_noStartCodeGiven_dropPacket) {
+    // Arrange
+    VideoAnalyzer analyzer;
+
+    // Act
+    bool result = receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 8, false));
+    FrameHandle frame = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_FALSE(result);
+    ASSERT_FALSE(frame);
+}
+
+TEST(VideoAnalyzer, Commit_otherSenderGiven_moveIntoFrameOfSender) {
+    // Arrange
+    VideoAnalyzer analyzer;
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true));
+
+    // Act
+    bool result = receive(analyzer, FIRST_DRONE, SECOND_DRONE, videoPacket(200, 2, true));
+    FrameHandle second = analyzer.take(SECOND_DRONE);
+    receive(analyzer, SECOND_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 3, true));
+    FrameHandle first = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_TRUE(result);
+    ASSERT_EQ(FULL_PACKET, first.length());
+    ASSERT_EQ(1, first.data()[FULL_PACKET - 1]);
+    ASSERT_EQ(200, second.length());
+    ASSERT_EQ(2, second.data()[199]);
+}
+
+TEST(VideoAnalyzer, ReceiveBuffer_largeFrameGiven_growBuffer) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(4096, 4);
+    VideoAnalyzer analyzer{pool};
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true));
+    for (int i = 0; i < 10; i++) {
+        receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 2, false));
+    }
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 3, true));
+    FrameHandle frame = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(11 * FULL_PACKET, frame.length());
+}
+
+TEST(VideoAnalyzer, Take_streamStartsWithPFrames_dropUntilIdr) {
+    // Arrange
+    VideoAnalyzer analyzer;
+
+    // Act
+    int pFrame = receiveFrame(analyzer, 0x41, 2);
+    int idrFrame = receiveFrame(analyzer, 0x65, 2);
+    int nextPFrame = receiveFrame(analyzer, 0x41, 2);
+
+    // Assert
+    ASSERT_EQ(0, pFrame);
+    ASSERT_EQ(1, idrFrame);
+    ASSERT_EQ(1, nextPFrame);
+    ASSERT_EQ(1, analyzer.statistics(FIRST_DRONE)._framesDropped);
+}
+
+TEST(VideoAnalyzer, Commit_lostFrameStartGiven_dropUntilIdr) {
+    // Arrange
+    VideoAnalyzer analyzer;
+    receiveFrame(analyzer, 0x65, 2);
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, false));
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false));
+    int pFrame = receiveFrame(analyzer, 0x41, 2);
+    int idrFrame = receiveFrame(analyzer, 0x65, 1);
+    VideoStatistics statistics = analyzer.statistics(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(0, pFrame);
+    ASSERT_EQ(1, idrFrame);
+    ASSERT_EQ(1, statistics._lossEvents);
+    ASSERT_EQ(2, statistics._framesDelivered);
+}
+
+TEST(VideoAnalyzer, Commit_frameStartsInsidePacket_dropCorruptFrame) {
+    // Arrange
+    VideoAnalyzer analyzer;
+    receiveFrame(analyzer, 0x65, 1);
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true, 0x41));
+    std::vector<unsigned char> spliced = videoPacket(FULL_PACKET, 1, false);
+    std::memcpy(spliced.data() + 500, videoPacket(6, 1, true, 0x41).data(), 6);
+
+    // Act
+    bool complete = receive(analyzer, FIRST_DRONE, FIRST_DRONE, spliced);
+    FrameHandle frame = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_TRUE(complete);
+    ASSERT_FALSE(frame);
+    ASSERT_EQ(1, analyzer.statistics(FIRST_DRONE)._corruptFrames);
+}
+
+TEST(VideoAnalyzer, Commit_packetAfterTimeout_discardStaleFrame) {
+    // Arrange
+    VideoAnalyzer analyzer;
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true), 0);
+
+    // Act
+    bool complete = receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false),
+                            VIDEO_STALE_TIMEOUT_US + 1);
+    VideoStatistics statistics = analyzer.statistics(FIRST_DRONE);
+
+    // Assert
+    ASSERT_FALSE(complete);
+    ASSERT_EQ(1, statistics._staleFrames);
+    ASSERT_EQ(FULL_PACKET + 100, statistics._bytesDropped);
+}
+
+TEST(VideoAnalyzer, Commit_frameBeyondLimit_discardFrame) {
+    // Arrange
+    VideoLimits limits;
+    limits._maxFrameLength = 4 * FULL_PACKET;
+    VideoAnalyzer analyzer{std::make_shared<FramePool>(), limits};
+
+    // Act
+    int oversized = receiveFrame(analyzer, 0x65, 6);
+    int next = receiveFrame(analyzer, 0x65, 2);
+    VideoStatistics statistics = analyzer.statistics(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(0, oversized);
+    ASSERT_EQ(1, next);
+    ASSERT_EQ(1, statistics._oversizeFrames);
+}
+
+TEST(VideoResponse, Copy_frameHandleGiven_shareBuffer) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(64, 2);
+    FrameBuffer* buffer = pool->acquire();
+    std::memset(buffer->tail(), 5, 10);
+    buffer->commit(10);
+
+    // Act
+    VideoResponse response{pool->share(buffer)};
+    VideoResponse copy = response;
+
+    // Assert
+    ASSERT_EQ(buffer->data(), response.videoFrame());
+    ASSERT_EQ(response.videoFrame(), copy.videoFrame());
+    ASSERT_EQ(10, copy.length());
+    ASSERT_EQ(2, copy.frame().useCount());
+}
+
+TEST(VideoResponse, Constructor_rawFrameGiven_copyFrame) {
+    // Arrange
+    unsigned char raw[] = {0, 0, 0, 1, 9};
+
+    // Act
+    VideoResponse response{raw, sizeof(raw)};
+
+    // Assert
+    ASSERT_NE(raw, response.videoFrame());
+    ASSERT_EQ(5, response.length());
+    ASSERT_EQ(9, response.videoFrame()[4]);
+}
+
+TEST(VideoAnalyzer, Take_framesDelivered_numberFrames) {
+    // Arrange
+    VideoAnalyzer analyzer;
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, true));
+    FrameHandle first = analyzer.take(FIRST_DRONE);
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, true, 0x41));
+    FrameHandle second = analyzer.take(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(1, first.info()._sequence);
+    ASSERT_EQ(2, second.info()._sequence);
+}
+
+TEST(VideoAnalyzer, Take_frameOfSeveralPackets_receiveTimeOfFirstPacket) {
+    // Arrange
+    VideoAnalyzer analyzer;
+
+    // Act
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true), 1000);
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false), 3000);
+    FrameHandle frame = analyzer.take(FIRST_DRONE);
+    VideoStatistics statistics = analyzer.statistics(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(1000, frame.info()._receiveTime);
+    ASSERT_EQ(2, statistics._packets);
+    ASSERT_EQ(FULL_PACKET + 100, statistics._bytesReceived);
+}
+
+TEST(VideoAnalyzer, Take_allocationForbidden_dropFramesInsteadOfAllocating) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(FULL_PACKET * 4, 2);
+    pool->preallocate(2);
+    pool->forbidAllocation(true);
+    VideoAnalyzer analyzer{pool};
+    std::vector<FrameHandle> held;
+
+    // Act
+    for (int i = 0; i < 3; i++) {
+        receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, true));
+        for (FrameHandle frame = analyzer.take(FIRST_DRONE); frame; frame = analyzer.take(FIRST_DRONE)) {
+            held.push_back(std::move(frame));
+        }
+    }
+    VideoStatistics statistics = analyzer.statistics(FIRST_DRONE);
+
+    // Assert
+    ASSERT_EQ(2, pool->allocated());
+    ASSERT_EQ(1, held.size());
+    ASSERT_EQ(2, statistics._poolExhausted);
+    ASSERT_EQ(2, pool->refused());
+}
+
+TEST(VideoAnalyzer, ReceiveBuffer_allocationForbiddenAndFrameOutgrowsBuffer_dropFrameInsteadOfGrowing) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(FULL_PACKET * 4, 2);
+    pool->preallocate(2);
+    pool->forbidAllocation(true);
+    VideoAnalyzer analyzer{pool};
+    std::vector<FrameHandle> frames;
+
+    // Act
+    for (int i = 0; i < 4; i++) {
+        receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, i == 0));
+    }
+    VideoStatistics exceeded = analyzer.statistics(FIRST_DRONE);
+    size_t available = 0;
+    unsigned char* buffer = analyzer.receiveBuffer(FIRST_DRONE, available);
+    receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(FULL_PACKET, 1, true));
+    if (receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, false))) {
+        for (FrameHandle frame = analyzer.take(FIRST_DRONE); frame; frame = analyzer.take(FIRST_DRONE)) {
+            frames.push_back(std::move(frame));
+        }
+    }
+
+    // Assert
+    ASSERT_EQ(1, exceeded._capacityExceeded);
+    ASSERT_EQ(1, exceeded._framesDropped);
+    ASSERT_EQ(1, frames.size());
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_EQ(FULL_PACKET * 4, available);
+    ASSERT_EQ(FULL_PACKET + 100, frames[0].length());
+    ASSERT_EQ(2, pool->allocated());
+}
+
+TEST(VideoAnalyzer, Commit_noFreeBufferGiven_dropPacketsUntilBufferFree) {
+    // Arrange
+    auto pool = std::make_shared<FramePool>(FULL_PACKET * 4, 2);
+    pool->forbidAllocation(true);
+    VideoAnalyzer analyzer{pool};
+    std::vector<FrameHandle> frames;
+
+    // Act
+    for (int i = 0; i < 3; i++) {
+        ASSERT_FALSE(receive(analyzer, 0, FIRST_DRONE, videoPacket(100, 1, true)));
+    }
+    VideoStatistics exhausted = analyzer.statistics(FIRST_DRONE);
+    pool->preallocate(2);
+    if (receive(analyzer, FIRST_DRONE, FIRST_DRONE, videoPacket(100, 1, true))) {
+        for (FrameHandle frame = analyzer.take(FIRST_DRONE); frame; frame = analyzer.take(FIRST_DRONE)) {
+            frames.push_back(std::move(frame));
+        }
+    }
+
+    // Assert
+    ASSERT_EQ(3, exhausted._poolExhausted);
+    ASSERT_EQ(300, exhausted._bytesDropped);
+    ASSERT_EQ(1, frames.size());
+    ASSERT_EQ(2, pool->allocated());
+}
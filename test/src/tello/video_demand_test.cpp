@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "tello/video/video_demand.hpp"
+#include "tello/thread/subscriber_list.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using tello::Subscription;
+using tello::threading::SubscriberList;
+using tello::video::VideoDemand;
+
+using demand_handler = std::function<void(int)>;
+
+class RecordingSwitch {
+public:
+    bool operator()(bool streamon) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _switches.push_back(streamon);
+        return true;
+    }
+
+    std::vector<bool> switches() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _switches;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<bool> _switches;
+};
+
+TEST(VideoDemand, Changed_subscribersComeAndGo_switchStreamWithDelay) {
+    // Arrange
+    auto recording = std::make_shared<RecordingSwitch>();
+    auto subscribers = std::make_shared<SubscriberList<demand_handler>>();
+    VideoDemand demand([recording](bool streamon) { return (*recording)(streamon); });
+    subscribers->setChangeListener([&demand](int delta) { demand.changed(delta); });
+    Subscription first{subscribers, subscribers->add([](int) {})};
+    demand.enable(std::chrono::milliseconds(100));
+
+    // Act
+    bool wantedWithSubscriber = demand.wanted();
+    first.unsubscribe();
+    bool wantedWithoutSubscriber = demand.wanted();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    Subscription second{subscribers, subscribers->add([](int) {})};
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    std::vector<bool> afterGap = recording->switches();
+    second.unsubscribe();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    demand.disable();
+
+    // Assert
+    ASSERT_TRUE(wantedWithSubscriber);
+    ASSERT_FALSE(wantedWithoutSubscriber);
+    ASSERT_TRUE(afterGap.empty());
+    ASSERT_EQ(std::vector<bool>{false}, recording->switches());
+    ASSERT_TRUE(demand.wanted());
+}
+
+TEST(VideoDemand, Changed_switchFailsWithoutStreamoffDelay_retryWithBackoff) {
+    // Arrange
+    std::atomic<int> attempts{0};
+    VideoDemand demand([&attempts](bool) {
+        attempts++;
+        return false;
+    });
+
+    // Act
+    demand.enable(std::chrono::milliseconds(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(VIDEO_DEMAND_RETRY_MS / 2));
+    int attemptsBeforeRetry = attempts;
+    demand.disable();
+
+    // Assert
+    ASSERT_EQ(1, attemptsBeforeRetry);
+    ASSERT_TRUE(demand.streaming());
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <tello/video/video_health.hpp>
+#include <tello/video_analyzer.hpp>
+
+using tello::VideoHealth;
+using tello::VideoHealthStatistics;
+using tello::VideoStatistics;
+
+TEST(VideoHealth, Statistics_framesGiven_ratesOverWindow) {
+    // Arrange
+    VideoHealth health;
+    VideoStatistics reassembly;
+    reassembly._packets = 40;
+    reassembly._framesDelivered = 11;
+    reassembly._lossEvents = 1;
+
+    // Act
+    for (int i = 0; i <= 10; i++) {
+        int64_t complete = 1000000 + i * 40000 + (i % 2 == 0 ? 0 : 2000);
+        health.frame(1000, i % 5 == 0, complete - 500, complete);
+    }
+    health.reassembly(reassembly);
+    VideoHealthStatistics statistics = health.statistics();
+
+    // Assert
+    ASSERT_EQ(40, statistics._packets);
+    ASSERT_EQ(11, statistics._frames);
+    ASSERT_EQ(1, statistics._lossEvents);
+    ASSERT_EQ(3, statistics._keyframes);
+    ASSERT_EQ(5, statistics._keyframeInterval);
+    ASSERT_NEAR(25.0, statistics._fps, 0.01);
+    ASSERT_NEAR(200000.0, statistics._bitrate, 1.0);
+    ASSERT_GT(statistics._jitter, 0.0);
+    ASSERT_EQ(500, statistics._reassemblyLatency);
+    ASSERT_EQ(1400000, statistics._lastFrame);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <tello/video/video_queue.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include <vector>
+
+using tello::VideoQueue;
+using tello::VideoDropPolicy;
+using tello::VideoQueueStatistics;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::FrameInfo;
+
+/**
+ * Frame of one byte 'id' without a pool
+ */
+FrameHandle queuedFrame(unsigned char id, bool keyframe, bool reference) {
+    auto* buffer = new FrameBuffer(16);
+    buffer->tail()[0] = id;
+    buffer->commit(1);
+    FrameInfo info;
+    info._keyframe = keyframe;
+    info._reference = reference;
+    buffer->setInfo(info);
+    return FrameHandle{buffer};
+}
+
+std::vector<unsigned char> drain(VideoQueue& queue) {
+    std::vector<unsigned char> ids;
+    for (FrameHandle frame = queue.pop(); frame; frame = queue.pop()) {
+        ids.push_back(frame.data()[0]);
+    }
+    return ids;
+}
+
+TEST(VideoQueue, Push_idleQueueGiven_startDrainOnce) {
+    // Arrange
+    VideoQueue queue{4};
+
+    // Act
+    bool first = queue.push(queuedFrame(1, true, true));
+    bool second = queue.push(queuedFrame(2, false, true));
+    std::vector<unsigned char> ids = drain(queue);
+    bool afterDrain = queue.push(queuedFrame(3, false, true));
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(second);
+    ASSERT_EQ((std::vector<unsigned char>{1, 2}), ids);
+    ASSERT_TRUE(afterDrain);
+}
+
+TEST(VideoQueue, Push_fullQueueWithDropOldestGiven_dropOldestFrame) {
+    // Arrange
+    VideoQueue queue{2, VideoDropPolicy::DROP_OLDEST};
+
+    // Act
+    for (unsigned char id = 1; id <= 4; id++) {
+        queue.push(queuedFrame(id, false, true));
+    }
+    VideoQueueStatistics statistics = queue.statistics();
+
+    // Assert
+    ASSERT_EQ(2, statistics._depth);
+    ASSERT_EQ(4, statistics._enqueued);
+    ASSERT_EQ(2, statistics._dropped);
+    ASSERT_EQ((std::vector<unsigned char>{3, 4}), drain(queue));
+}
+
+TEST(VideoQueue, Push_fullQueueWithDropNonReferenceGiven_keepReferenceFrames) {
+    // Arrange
+    VideoQueue queue{3, VideoDropPolicy::DROP_NON_REFERENCE};
+
+    // Act
+    queue.push(queuedFrame(1, true, true));
+    queue.push(queuedFrame(2, false, false));
+    queue.push(queuedFrame(3, false, true));
+    queue.push(queuedFrame(4, false, true));
+
+    // Assert
+    ASSERT_EQ((std::vector<unsigned char>{1, 3, 4}), drain(queue));
+}
+
+TEST(VideoQueue, Push_fullQueueWithLatestGopGiven_dropUntilKeyframe) {
+    // Arrange
+    VideoQueue queue{2, VideoDropPolicy::LATEST_GOP};
+
+    // Act
+    queue.push(queuedFrame(1, true, true));
+    queue.push(queuedFrame(2, false, true));
+    queue.push(queuedFrame(3, false, true));
+    std::vector<unsigned char> full = drain(queue);
+    queue.push(queuedFrame(4, false, true));
+    queue.push(queuedFrame(5, true, true));
+    queue.push(queuedFrame(6, false, true));
+
+    // Assert
+    ASSERT_EQ((std::vector<unsigned char>{1, 2}), full);
+    ASSERT_EQ((std::vector<unsigned char>{5, 6}), drain(queue));
+    ASSERT_EQ(2, queue.statistics()._dropped);
+}
@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+#include <tello/video/video_recorder.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include <tello/video/video_reader.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define TELLO_IP_ADDRESS (ip_address)0xC0A80A01 // 192.168.10.1
+
+using tello::VideoRecorder;
+using tello::VideoSegmentPolicy;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::FrameInfo;
+using tello::VideoReader;
+using tello::VideoIndexEntry;
+using std::string;
+
+FrameHandle recordedFrame(unsigned char fill, size_t length, bool keyframe, bool parameterSets = false) {
+    auto* buffer = new FrameBuffer(length);
+    std::memset(buffer->tail(), fill, length);
+    buffer->commit(length);
+    FrameInfo info;
+    info._keyframe = keyframe;
+    info._reference = true;
+    info._parameterSets = parameterSets;
+    info._nalType = keyframe ? tello::NalUnitType::IDR_SLICE
+                             : parameterSets ? tello::NalUnitType::SPS : tello::NalUnitType::NON_IDR_SLICE;
+    buffer->setInfo(info);
+    return FrameHandle{buffer};
+}
+
+std::vector<unsigned char> readFile(const string& path) {
+    std::vector<unsigned char> content;
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file != nullptr) {
+        unsigned char buffer[4096];
+        size_t read;
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            content.insert(content.end(), buffer, buffer + read);
+        }
+        std::fclose(file);
+    }
+    return content;
+}
+
+TEST(VideoRecorder, Record_segmentLimitReached_rotateOnKeyframe) {
+    // Arrange
+    string directory = ".";
+    string first;
+    string second;
+    VideoSegmentPolicy policy;
+    policy._maxBytes = 150;
+
+    // Act
+    {
+        VideoRecorder recorder(directory, policy);
+        first = VideoRecorder::path(directory, TELLO_IP_ADDRESS, recorder.session(), 1);
+        second = VideoRecorder::path(directory, TELLO_IP_ADDRESS, recorder.session(), 2);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(1, 50, false), 0);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(2, 100, true, true), 10);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(3, 100, false), 20);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(4, 10, false), 30);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(5, 100, true, true), 40);
+        recorder.stop();
+
+        ASSERT_EQ(4u, recorder.recorded());
+        ASSERT_EQ(1u, recorder.dropped());
+        ASSERT_EQ(2u, recorder.segments());
+    }
+
+    // Assert
+    std::vector<unsigned char> firstSegment = readFile(first);
+    std::vector<unsigned char> secondSegment = readFile(second);
+    ASSERT_EQ(210, firstSegment.size());
+    ASSERT_EQ(2, firstSegment.front());
+    ASSERT_EQ(4, firstSegment.back());
+    ASSERT_EQ(100, secondSegment.size());
+    ASSERT_EQ(5, secondSegment.front());
+
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+    std::remove((first.substr(0, first.size() - 5) + ".tvix").c_str());
+    std::remove((second.substr(0, second.size() - 5) + ".tvix").c_str());
+}
+
+TEST(VideoRecorder, Record_limitReached_dropInsteadOfHoldingMoreFrames) {
+    // Arrange
+    string directory = ".";
+    VideoRecorder recorder(directory);
+    recorder.limit(2);
+    string segment = VideoRecorder::path(directory, TELLO_IP_ADDRESS, recorder.session(), 1);
+
+    // Act
+    bool first = recorder.record(TELLO_IP_ADDRESS, recordedFrame(1, 10, true, true), 0);
+    bool second = recorder.record(TELLO_IP_ADDRESS, recordedFrame(2, 10, false), 10);
+    bool third = recorder.record(TELLO_IP_ADDRESS, recordedFrame(3, 10, false), 20);
+    recorder.stop();
+
+    // Assert
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_FALSE(third);
+    ASSERT_EQ(2u, recorder.recorded());
+    ASSERT_EQ(1u, recorder.dropped());
+
+    std::remove(segment.c_str());
+    std::remove(VideoRecorder::indexPath(directory, TELLO_IP_ADDRESS, recorder.session(), 1).c_str());
+}
+
+TEST(VideoRecorder, Record_keyframeWithoutParameterSetsGiven_prependParameterSets) {
+    // Arrange
+    string directory = ".";
+    string path;
+    string indexPath;
+    uint64_t session = 0;
+    VideoReader reader;
+
+    // Act
+    {
+        VideoRecorder recorder(directory);
+        session = recorder.session();
+        path = VideoRecorder::path(directory, TELLO_IP_ADDRESS, session, 1);
+        indexPath = VideoRecorder::indexPath(directory, TELLO_IP_ADDRESS, session, 1);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(1, 20, false, true), 0);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(2, 100, true), 10);
+        recorder.stop();
+    }
+    bool opened = reader.open(directory, TELLO_IP_ADDRESS, session);
+
+    // Assert
+    std::vector<unsigned char> segment = readFile(path);
+    ASSERT_EQ(120, segment.size());
+    ASSERT_EQ(1, segment.front());
+    ASSERT_EQ(2, segment.back());
+    ASSERT_TRUE(opened);
+    ASSERT_EQ(tello::NalUnitType::SPS, reader.entry(0)._type);
+    ASSERT_TRUE(reader.entry(0)._parameterSets);
+    ASSERT_EQ(tello::NalUnitType::IDR_SLICE, reader.entry(1)._type);
+
+    reader.close();
+
+    std::remove(path.c_str());
+    std::remove(indexPath.c_str());
+}
+
+
+/**
+ * Two segments: keyframes at 100 and 400 in the first, at 700 in the second one
+ * @return session of the recording
+ */
+uint64_t recordTwoSegments(const string& directory) {
+    VideoSegmentPolicy policy;
+    policy._maxDuration = 500;
+    VideoRecorder recorder(directory, policy);
+    for (int i = 0; i < 9; i++) {
+        bool keyframe = i % 3 == 0;
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(static_cast<unsigned char>(i), 10 + i, keyframe, keyframe),
+                        100 + i * 100);
+    }
+    recorder.stop();
+    return recorder.session();
+}
+
+void removeSegments(const string& directory, uint64_t session) {
+    for (unsigned int segment = 1; segment <= 2; segment++) {
+        std::remove(VideoRecorder::path(directory, TELLO_IP_ADDRESS, session, segment).c_str());
+        std::remove(VideoRecorder::indexPath(directory, TELLO_IP_ADDRESS, session, segment).c_str());
+    }
+}
+
+TEST(VideoReader, Seek_recordedSegmentsGiven_jumpToLastKeyframeBefore) {
+    // Arrange
+    string directory = ".";
+    uint64_t session = recordTwoSegments(directory);
+    VideoReader reader;
+
+    // Act
+    bool opened = reader.open(directory, TELLO_IP_ADDRESS, session);
+    optional<size_t> beforeFirst = reader.seek(50);
+    optional<size_t> first = reader.seek(350);
+    optional<size_t> second = reader.seek(650);
+    optional<size_t> last = reader.seek(5000);
+
+    // Assert
+    ASSERT_TRUE(opened);
+    ASSERT_EQ(2, reader.segmentCount());
+    ASSERT_EQ(9, reader.frameCount());
+    ASSERT_EQ(3, reader.keyframeCount());
+    ASSERT_FALSE(beforeFirst.has_value());
+    ASSERT_EQ(0, *first);
+    ASSERT_EQ(3, *second);
+    ASSERT_EQ(6, *last);
+
+    VideoIndexEntry entry = reader.entry(6);
+    ASSERT_EQ(700, entry._timestamp);
+    ASSERT_EQ(2, entry._segment);
+    ASSERT_EQ(0, entry._offset);
+    ASSERT_TRUE(entry._keyframe);
+    ASSERT_EQ(tello::NalUnitType::IDR_SLICE, entry._type);
+
+    size_t length = 0;
+    const unsigned char* frame = reader.frame(7, length);
+    ASSERT_EQ(17, length);
+    ASSERT_EQ(7, frame[0]);
+    ASSERT_EQ(7, frame[16]);
+
+    reader.close();
+    removeSegments(directory, session);
+}
+
+TEST(VideoReader, Open_indexWithoutKeyframeTableGiven_scanForKeyframes) {
+    // Arrange
+    string directory = ".";
+    uint64_t session = recordTwoSegments(directory);
+    // an interrupted recording lacks the keyframe table: 2 keyframes and the trailer
+    string indexPath = VideoRecorder::indexPath(directory, TELLO_IP_ADDRESS, session, 1);
+    std::vector<unsigned char> index = readFile(indexPath);
+    std::FILE* file = std::fopen(indexPath.c_str(), "wb");
+    std::fwrite(index.data(), 1, index.size() - 2 * sizeof(uint32_t) - 8, file);
+    std::fclose(file);
+    VideoReader reader;
+
+    // Act
+    bool opened = reader.open(directory, TELLO_IP_ADDRESS, session);
+
+    // Assert
+    ASSERT_TRUE(opened);
+    ASSERT_EQ(9, reader.frameCount());
+    ASSERT_EQ(3, reader.keyframeCount());
+    ASSERT_EQ(3, *reader.seek(450));
+
+    reader.close();
+    removeSegments(directory, session);
+}
+
+TEST(VideoReader, Open_laterSessionRecorded_keepAndReadSessionsApart) {
+    // Arrange
+    string directory = ".";
+    uint64_t first = recordTwoSegments(directory);
+    uint64_t second = 0;
+    {
+        VideoRecorder recorder(directory);
+        recorder.record(TELLO_IP_ADDRESS, recordedFrame(42, 30, true, true), 100);
+        recorder.stop();
+        second = recorder.session();
+    }
+    VideoReader firstReader;
+    VideoReader secondReader;
+
+    VideoReader latestReader;
+
+    // Act
+    bool firstOpened = firstReader.open(directory, TELLO_IP_ADDRESS, first);
+    bool secondOpened = secondReader.open(directory, TELLO_IP_ADDRESS, second);
+    bool latestOpened = latestReader.open(directory, TELLO_IP_ADDRESS);
+    std::vector<uint64_t> sessions = VideoReader::sessions(directory, TELLO_IP_ADDRESS);
+
+    // Assert
+    ASSERT_NE(first, second);
+    ASSERT_TRUE(firstOpened);
+    ASSERT_EQ(9, firstReader.frameCount());
+    ASSERT_TRUE(secondOpened);
+    ASSERT_EQ(1, secondReader.segmentCount());
+    ASSERT_EQ(1, secondReader.frameCount());
+    size_t length = 0;
+    ASSERT_EQ(42, secondReader.frame(0, length)[0]);
+    ASSERT_TRUE(latestOpened);
+    ASSERT_EQ(42, latestReader.frame(0, length)[0]);
+    ASSERT_EQ(first, sessions[sessions.size() - 2]);
+    ASSERT_EQ(second, sessions.back());
+
+    firstReader.close();
+    secondReader.close();
+    latestReader.close();
+    removeSegments(directory, first);
+    removeSegments(directory, second);
+}
\ No newline at end of file
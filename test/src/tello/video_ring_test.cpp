@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <tello/video/video_ring.hpp>
+#include <tello/video/frame_buffer.hpp>
+#include <tello/video/frame_handle.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#define TELLO_IP_ADDRESS (ip_address)0xC0A80A01 // 192.168.10.1
+
+using tello::VideoRingPublisher;
+using tello::VideoRingReader;
+using tello::VideoRingFrame;
+using tello::FrameBuffer;
+using tello::FrameHandle;
+using tello::FrameInfo;
+using std::string;
+
+FrameHandle ringFrame(unsigned char fill, size_t length, bool keyframe) {
+    auto* buffer = new FrameBuffer(length);
+    std::memset(buffer->tail(), fill, length);
+    buffer->commit(length);
+    FrameInfo info;
+    info._keyframe = keyframe;
+    buffer->setInfo(info);
+    return FrameHandle{buffer};
+}
+
+TEST(VideoRing, Frame_publishedFramesGiven_readWithoutCopy) {
+    // Arrange
+    string directory = ".";
+    VideoRingPublisher publisher(directory, 4, 1024);
+    VideoRingReader reader;
+
+    // Act
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(1, 100, true), 1000);
+    bool opened = reader.open(directory, TELLO_IP_ADDRESS);
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(2, 200, false), 2000);
+    optional<VideoRingFrame> first = reader.frame(1);
+    optional<VideoRingFrame> second = reader.frame(reader.latest());
+
+    // Assert
+    ASSERT_TRUE(opened);
+    ASSERT_EQ(2, reader.latest());
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(first->_keyframe);
+    ASSERT_EQ(100, first->_length);
+    ASSERT_EQ(1, first->_data[99]);
+    ASSERT_EQ(2000, second->_timestamp);
+    ASSERT_EQ(200, second->_length);
+    ASSERT_EQ(2, second->_data[0]);
+    ASSERT_FALSE(reader.frame(3).has_value());
+    ASSERT_TRUE(reader.waitFor(2, 0));
+    ASSERT_FALSE(reader.waitFor(3, 1000));
+
+    reader.close();
+    std::remove(VideoRingPublisher::path(directory, TELLO_IP_ADDRESS).c_str());
+}
+
+TEST(VideoRing, WaitFor_framePublishedWhileWaiting_wakeBeforeTimeout) {
+    // Arrange
+    string directory = ".";
+    VideoRingPublisher publisher(directory, 4, 1024);
+    VideoRingReader reader;
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(1, 100, true), 1000);
+    bool opened = reader.open(directory, TELLO_IP_ADDRESS);
+    std::thread publishing([&publisher]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        publisher.publish(TELLO_IP_ADDRESS, ringFrame(2, 100, false), 2000);
+    });
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    bool published = reader.waitFor(2, 5000000);
+    auto waited = std::chrono::steady_clock::now() - start;
+    publishing.join();
+
+    // Assert
+    ASSERT_TRUE(opened);
+    ASSERT_TRUE(published);
+    ASSERT_LT(waited, std::chrono::seconds(1));
+
+    reader.close();
+    std::remove(VideoRingPublisher::path(directory, TELLO_IP_ADDRESS).c_str());
+}
+
+TEST(VideoRing, Valid_slotOverwrittenGiven_rejectFrame) {
+    // Arrange
+    string directory = ".";
+    VideoRingPublisher publisher(directory, 2, 1024);
+    VideoRingReader reader;
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(1, 100, true), 1000);
+    reader.open(directory, TELLO_IP_ADDRESS);
+    optional<VideoRingFrame> first = reader.frame(1);
+
+    // Act
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(2, 100, false), 2000);
+    publisher.publish(TELLO_IP_ADDRESS, ringFrame(3, 100, false), 3000);
+    bool tooLarge = publisher.publish(TELLO_IP_ADDRESS, ringFrame(4, 2000, false), 4000);
+
+    // Assert
+    ASSERT_TRUE(first.has_value());
+    ASSERT_FALSE(reader.valid(*first));
+    ASSERT_FALSE(reader.frame(1).has_value());
+    ASSERT_TRUE(reader.frame(3).has_value());
+    ASSERT_FALSE(tooLarge);
+    ASSERT_EQ(1, publisher.dropped());
+
+    reader.close();
+    std::remove(VideoRingPublisher::path(directory, TELLO_IP_ADDRESS).c_str());
+}
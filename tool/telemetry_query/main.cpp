@@ -0,0 +1,203 @@
+#include <tello/telemetry/telemetry_query.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using tello::FieldAggregate;
+using tello::FieldSelection;
+using tello::StatusField;
+using tello::TelemetryAggregate;
+using tello::TelemetryPredicate;
+using tello::TelemetryQuery;
+using tello::TelemetryQueryEngine;
+using tello::TelemetryQueryResult;
+using std::string;
+using std::vector;
+
+namespace {
+
+    void usage() {
+        std::printf("usage: telemetry_query [options] <recording>...\n"
+                    "  recordings are archives (.tta) or columnar recordings (.tcol)\n\n"
+                    "  --threads <n>                 worker threads (default: all cores)\n"
+                    "  --from <seconds>              start of the time range\n"
+                    "  --to <seconds>                end of the time range\n"
+                    "  --absolute                    time range in seconds since epoch instead of\n"
+                    "                                relative to the start of each recording\n"
+                    "  --where <field>:<min>:<max>   only samples with min <= field <= max\n"
+                    "  --fields <field>[,<field>]    aggregated fields (default: all)\n\n"
+                    "example: telemetry_query --from 120 --to 180 --fields pitch,roll flight_*.tta\n");
+    }
+
+    bool parseNumber(const string& value, double& number) {
+        try {
+            size_t parsed = 0;
+            number = std::stod(value, &parsed);
+            if (parsed == value.size()) {
+                return true;
+            }
+        } catch (const std::invalid_argument&) {
+        } catch (const std::out_of_range&) {
+        }
+        std::fprintf(stderr, "invalid number '%s'\n", value.c_str());
+        return false;
+    }
+
+    bool parseCount(const string& value, unsigned int& count) {
+        try {
+            size_t parsed = 0;
+            unsigned long number = std::stoul(value, &parsed);
+            if (parsed == value.size() && value[0] != '-' && number <= 0xFFFFFFFFul) {
+                count = static_cast<unsigned int>(number);
+                return true;
+            }
+        } catch (const std::invalid_argument&) {
+        } catch (const std::out_of_range&) {
+        }
+        std::fprintf(stderr, "invalid count '%s'\n", value.c_str());
+        return false;
+    }
+
+    bool parseFields(const string& value, FieldSelection& fields) {
+        std::stringstream stream(value);
+        string name;
+        while (std::getline(stream, name, ',')) {
+            auto field = tello::fieldByName(name);
+            if (!field) {
+                std::fprintf(stderr, "unknown field '%s'\n", name.c_str());
+                return false;
+            }
+            fields.set(static_cast<int>(*field));
+        }
+        return true;
+    }
+
+    bool parsePredicate(const string& value, TelemetryPredicate& predicate) {
+        size_t first = value.find(':');
+        size_t second = value.find(':', first == string::npos ? first : first + 1);
+        if (first == string::npos || second == string::npos) {
+            std::fprintf(stderr, "predicate '%s' has to look like <field>:<min>:<max>\n", value.c_str());
+            return false;
+        }
+
+        auto field = tello::fieldByName(value.substr(0, first));
+        if (!field) {
+            std::fprintf(stderr, "unknown field '%s'\n", value.substr(0, first).c_str());
+            return false;
+        }
+        predicate._field = *field;
+        return parseNumber(value.substr(first + 1, second - first - 1), predicate._min) &&
+               parseNumber(value.substr(second + 1), predicate._max);
+    }
+
+    string ipToString(ip_address ip) {
+        return std::to_string((ip >> 24) & 0xFF) + "." + std::to_string((ip >> 16) & 0xFF) + "." +
+               std::to_string((ip >> 8) & 0xFF) + "." + std::to_string(ip & 0xFF);
+    }
+
+    void print(const TelemetryAggregate& aggregate, const FieldSelection& fields) {
+        std::printf("  samples: %llu\n", aggregate._samples);
+        if (aggregate._samples == 0) {
+            return;
+        }
+        std::printf("  %-6s %12s %12s %12s %12s %12s %12s\n", "field", "min", "max", "mean", "first", "last",
+                    "rate/s");
+        for (int f = 0; f < STATUS_FIELD_COUNT; f++) {
+            if (!fields.test(f)) {
+                continue;
+            }
+            const FieldAggregate& field = aggregate._fields[f];
+            std::printf("  %-6s %12.2f %12.2f %12.2f %12.2f %12.2f %12.4f\n",
+                        tello::fieldName(static_cast<StatusField>(f)), field._min, field._max, field.mean(),
+                        field._first, field._last, field.rate());
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    TelemetryQuery query;
+    query._relativeTime = true;
+    unsigned int threads = std::thread::hardware_concurrency();
+    vector<string> recordings;
+
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (argument == "--help" || argument == "-h") {
+            usage();
+            return 0;
+        } else if (argument == "--absolute") {
+            query._relativeTime = false;
+        } else if (argument == "--threads" && hasValue) {
+            if (!parseCount(argv[++i], threads)) {
+                usage();
+                return 1;
+            }
+        } else if ((argument == "--from" || argument == "--to") && hasValue) {
+            double seconds = 0;
+            if (!parseNumber(argv[++i], seconds)) {
+                usage();
+                return 1;
+            }
+            int64_t time = static_cast<int64_t>(seconds * 1000000.0);
+            if (argument == "--from") {
+                query._from = time;
+            } else {
+                query._to = time;
+            }
+        } else if (argument == "--where" && hasValue) {
+            TelemetryPredicate predicate{};
+            if (!parsePredicate(argv[++i], predicate)) {
+                usage();
+                return 1;
+            }
+            query._predicates.push_back(predicate);
+        } else if (argument == "--fields" && hasValue) {
+            if (!parseFields(argv[++i], query._fields)) {
+                return 1;
+            }
+        } else if (argument.rfind("--", 0) == 0) {
+            usage();
+            return 1;
+        } else {
+            recordings.push_back(argument);
+        }
+    }
+
+    if (recordings.empty()) {
+        usage();
+        return 1;
+    }
+    if (query._fields.none()) {
+        query._fields.set();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    TelemetryQueryEngine engine(threads);
+    TelemetryQueryResult result = engine.run(recordings, query);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    for (const auto& recording : result._recordings) {
+        std::printf("%s (drone %s)\n", recording._path.c_str(), ipToString(recording._drone).c_str());
+        print(recording._aggregate, query._fields);
+    }
+    if (result._recordings.size() > 1) {
+        for (const auto& drone : result._drones) {
+            std::printf("drone %s (all recordings)\n", ipToString(drone.first).c_str());
+            print(drone.second, query._fields);
+        }
+    }
+    for (const auto& failed : result._failed) {
+        std::fprintf(stderr, "cannot read %s\n", failed.c_str());
+    }
+
+    std::printf("\n%zu recordings, %llu blocks scanned, %llu blocks skipped, %llu samples decoded in %lld ms\n",
+                result._recordings.size(), result._blocksScanned, result._blocksSkipped, result._samplesScanned,
+                static_cast<long long>(elapsed.count()));
+    return result._failed.empty() ? 0 : 2;
+}
@@ -0,0 +1,267 @@
+#include "tello/video/start_code.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define PCAPNG_SECTION_HEADER 0x0A0D0D0A
+#define PCAPNG_ENHANCED_PACKET 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+#define ETHERNET_HEADER_LENGTH 14
+#define ETHER_TYPE_VLAN 0x8100
+#define ETHER_TYPE_IPV4 0x0800
+#define IP_PROTOCOL_UDP 17
+#define UDP_HEADER_LENGTH 8
+#define BENCHMARK_BYTES (256u * 1024u * 1024u)
+#define BENCHMARK_ROUNDS 5
+#define SYNTHETIC_BYTES (16u * 1024u * 1024u)
+#define SYNTHETIC_GOP_FRAMES 30
+#define SYNTHETIC_MIN_NAL_UNIT 1000
+#define SYNTHETIC_MAX_NAL_UNIT 12000
+#define SYNTHETIC_KEYFRAME_BYTES 40000
+#define VIDEO_BYTES_PER_START_CODE (64u * 1024u)
+
+using tello::video::start_code_finder;
+using std::string;
+using std::vector;
+
+namespace {
+
+    void usage() {
+        std::printf("usage: video_benchmark [options] [capture.pcapng]\n"
+                    "  scans the UDP payloads of the capture and a synthetic Annex-B stream for H.264 start codes\n"
+                    "  (default: wireshark_capture/tello_takeoff_fly_land.pcapng, it holds command and state\n"
+                    "  traffic only, the synthetic stream is the representative measurement for video)\n\n"
+                    "  --port <port>   only payloads sent from or to this port, e.g. 11111 for video\n");
+    }
+
+    bool parsePort(const string& value, int& port) {
+        try {
+            size_t parsed = 0;
+            int number = std::stoi(value, &parsed);
+            if (parsed == value.size() && number > 0 && number <= 0xFFFF) {
+                port = number;
+                return true;
+            }
+        } catch (const std::invalid_argument&) {
+        } catch (const std::out_of_range&) {
+        }
+        std::fprintf(stderr, "invalid port '%s'\n", value.c_str());
+        return false;
+    }
+
+    uint32_t read32(const unsigned char* data, bool swap) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        if (swap) {
+            value = (value >> 24) | ((value >> 8) & 0xFF00) | ((value << 8) & 0xFF0000) | (value << 24);
+        }
+        return value;
+    }
+
+    uint16_t readNetwork16(const unsigned char* data) {
+        return static_cast<uint16_t>((data[0] << 8) | data[1]);
+    }
+
+    void appendUdpPayload(const unsigned char* frame, size_t length, int port, vector<unsigned char>& payloads,
+                          size_t& packets) {
+        if (length < ETHERNET_HEADER_LENGTH) {
+            return;
+        }
+        size_t offset = 12;
+        uint16_t etherType = readNetwork16(frame + offset);
+        if (etherType == ETHER_TYPE_VLAN && length >= offset + 6) {
+            offset += 4;
+            etherType = readNetwork16(frame + offset);
+        }
+        offset += 2;
+        if (etherType != ETHER_TYPE_IPV4 || length < offset + 20 || frame[offset + 9] != IP_PROTOCOL_UDP) {
+            return;
+        }
+
+        size_t udp = offset + (frame[offset] & 0x0F) * 4;
+        if (length < udp + UDP_HEADER_LENGTH) {
+            return;
+        }
+        uint16_t source = readNetwork16(frame + udp);
+        uint16_t destination = readNetwork16(frame + udp + 2);
+        if (port != 0 && source != port && destination != port) {
+            return;
+        }
+
+        payloads.insert(payloads.end(), frame + udp + UDP_HEADER_LENGTH, frame + length);
+        packets++;
+    }
+
+    bool readCapture(const string& path, int port, vector<unsigned char>& payloads, size_t& packets) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        vector<unsigned char> capture((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        bool swap = false;
+        size_t position = 0;
+        while (position + 12 <= capture.size()) {
+            const unsigned char* block = capture.data() + position;
+            uint32_t type = read32(block, false);
+            if (type == PCAPNG_SECTION_HEADER) {
+                swap = read32(block + 8, false) != PCAPNG_BYTE_ORDER_MAGIC;
+            }
+            uint32_t blockLength = read32(block + 4, swap);
+            if (blockLength < 12 || position + blockLength > capture.size()) {
+                return false;
+            }
+
+            if (type == PCAPNG_ENHANCED_PACKET && blockLength >= 28) {
+                uint32_t captured = read32(block + 20, swap);
+                if (28 + captured <= blockLength) {
+                    appendUdpPayload(block + 28, captured, port, payloads, packets);
+                }
+            }
+            position += blockLength;
+        }
+        return true;
+    }
+
+    /**
+     * Annex-B stream of pseudo random slices: a keyframe (SPS, PPS, large IDR slice) every SYNTHETIC_GOP_FRAMES
+     * frames, in between one slice of 1 to 12 KB per frame, about the slice density of the 720p/30 fps stream of a Tello.
+     * The slice bytes carry emulation prevention, so start codes only appear at NAL unit boundaries.
+     */
+    vector<unsigned char> syntheticStream(size_t& startCodes) {
+        vector<unsigned char> stream;
+        stream.reserve(SYNTHETIC_BYTES + SYNTHETIC_KEYFRAME_BYTES * 2);
+        uint32_t random = 0x12345678;
+        auto next = [&random]() {
+            random = random * 1664525u + 1013904223u;
+            return random >> 24;
+        };
+        auto nalUnit = [&stream, &startCodes, &next](unsigned char header, size_t length) {
+            stream.insert(stream.end(), {0, 0, 0, 1, header});
+            startCodes++;
+            int zeros = 0;
+            for (size_t i = 0; i < length; i++) {
+                auto byte = static_cast<unsigned char>(next());
+                if (zeros >= 2 && byte <= 3) {
+                    stream.push_back(3);
+                    zeros = 0;
+                }
+                stream.push_back(byte);
+                zeros = byte == 0 ? zeros + 1 : 0;
+            }
+            // a slice never ends with a zero byte (rbsp trailing bits)
+            stream.push_back(0x80);
+        };
+
+        startCodes = 0;
+        for (size_t frame = 0; stream.size() < SYNTHETIC_BYTES; frame++) {
+            if (frame % SYNTHETIC_GOP_FRAMES == 0) {
+                nalUnit(0x67, 10);
+                nalUnit(0x68, 4);
+                nalUnit(0x65, SYNTHETIC_KEYFRAME_BYTES);
+            } else {
+                size_t spread = SYNTHETIC_MAX_NAL_UNIT - SYNTHETIC_MIN_NAL_UNIT;
+                nalUnit(0x41, SYNTHETIC_MIN_NAL_UNIT + next() * spread / 255);
+            }
+        }
+        return stream;
+    }
+
+    size_t countStartCodes(const vector<unsigned char>& data) {
+        size_t found = 0;
+        for (size_t position = tello::video::findStartCodeScalar(data.data(), 0, data.size());
+             position != START_CODE_NOT_FOUND;
+             position = tello::video::findStartCodeScalar(data.data(), position + 3, data.size())) {
+            found++;
+        }
+        return found;
+    }
+
+    void benchmark(const char* name, start_code_finder finder, const vector<unsigned char>& data) {
+        size_t repetitions = BENCHMARK_BYTES / data.size() + 1;
+        double best = 0.0;
+        size_t found = 0;
+
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+            found = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t repetition = 0; repetition < repetitions; repetition++) {
+                for (size_t position = finder(data.data(), 0, data.size()); position != START_CODE_NOT_FOUND;
+                     position = finder(data.data(), position + 3, data.size())) {
+                    found++;
+                }
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            double throughput = static_cast<double>(repetitions * data.size()) / elapsed.count() / 1e9;
+            best = throughput > best ? throughput : best;
+        }
+
+        std::printf("%-8s %8.2f GB/s  %zu start codes per pass\n", name, best, found / repetitions);
+    }
+
+    void benchmarkAll(const vector<unsigned char>& data) {
+        benchmark("scalar", tello::video::findStartCodeScalar, data);
+#ifdef TELLO_START_CODE_SIMD
+        benchmark("sse2", tello::video::findStartCodeSse2, data);
+        if (tello::video::supportsAvx2()) {
+            benchmark("avx2", tello::video::findStartCodeAvx2, data);
+        }
+#endif
+    }
+}
+
+int main(int argc, char** argv) {
+    string path = "wireshark_capture/tello_takeoff_fly_land.pcapng";
+    int port = 0;
+
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        if (argument == "--port" && i + 1 < argc) {
+            if (!parsePort(argv[++i], port)) {
+                usage();
+                return 1;
+            }
+        } else if (argument == "--help" || argument == "-h") {
+            usage();
+            return 0;
+        } else if (argument.rfind("--", 0) == 0) {
+            usage();
+            return 1;
+        } else {
+            path = argument;
+        }
+    }
+
+    vector<unsigned char> payloads;
+    size_t packets = 0;
+    if (!readCapture(path, port, payloads, packets)) {
+        std::fprintf(stderr, "Cannot read pcapng capture %s\n", path.c_str());
+        return 1;
+    }
+    if (payloads.empty()) {
+        std::fprintf(stderr, "No UDP payloads in %s\n", path.c_str());
+        return 1;
+    }
+
+    size_t captureStartCodes = countStartCodes(payloads);
+    std::printf("selected scanner: %s\n\n", tello::video::startCodeScanner());
+    std::printf("capture %s: %zu UDP payloads, %zu bytes, %zu start codes\n", path.c_str(), packets,
+                payloads.size(), captureStartCodes);
+    if (captureStartCodes == 0 || payloads.size() / captureStartCodes > VIDEO_BYTES_PER_START_CODE) {
+        std::printf("note: the capture holds (almost) no video, e.g. only command and state datagrams,\n"
+                    "      its throughput says little about scanning video\n");
+    }
+    benchmarkAll(payloads);
+
+    size_t syntheticStartCodes = 0;
+    vector<unsigned char> synthetic = syntheticStream(syntheticStartCodes);
+    std::printf("\nsynthetic Annex-B stream: %zu bytes, %zu start codes (one per %zu bytes)\n", synthetic.size(),
+                syntheticStartCodes, synthetic.size() / syntheticStartCodes);
+    benchmarkAll(synthetic);
+    return 0;
+}